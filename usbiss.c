@@ -29,7 +29,18 @@
 #include <stdint.h>     // defines fixed data types, like int8_t...
 #include <string.h>     // string handling functions
 #include <strings.h>    // strcasecmp
+#include <ctype.h>      // isalnum
 #include <stdarg.h>     // variable parameter list
+#if defined(_WIN32)
+    #include <windows.h>    // QueryPerformanceCounter
+#else
+    #include <time.h>       // clock_gettime
+#endif
+#if defined(__linux__)
+    #include <dirent.h>         // sysfs directory listing
+    #include <unistd.h>         // read, close
+    #include <sys/inotify.h>    // hotplug events
+#endif
 /** Custom Libs **/
 #include "simple_uart.h"    // cross platform UART driver
 /** self **/
@@ -57,6 +68,90 @@
 
 
 
+/**
+ *  @defgroup USBISS_REG_FLAG
+ *
+ *  @brief Register cache flags
+ *
+ *  per register flags of #t_usbiss_regcache, attribute #USBISS_REGCACHE in lower bits
+ *
+ *  @{
+ */
+#define USBISS_REG_ATTR     (0x03)  /**< attribute mask */
+#define USBISS_REG_DIRTY    (0x40)  /**< write buffered, not transferred */
+#define USBISS_REG_VLD      (0x80)  /**< cached value valid */
+/** @} */   // USBISS_REG_FLAG
+
+
+
+/**
+ *  @brief I2C clock ladder
+ *
+ *  I2C transfer modes ordered from slowest to fastest
+ *
+ *  @since  October 18, 2026
+ */
+static const uint8_t usbiss_i2c_clk_ladder[USBISS_I2C_NUM_CLK] = {
+    USBISS_I2C_S_20KHZ,
+    USBISS_I2C_S_50KHZ,
+    USBISS_I2C_S_100KHZ,
+    USBISS_I2C_H_100KHZ,
+    USBISS_I2C_S_400KHZ,
+    USBISS_I2C_H_400KHZ,
+    USBISS_I2C_H_1000KHZ
+};
+
+
+
+/**
+ *  @brief Time
+ *
+ *  monotonic system time
+ *
+ *  @return         uint64_t            time in us
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint64_t usbiss_time_us( void )
+{
+#if defined(_WIN32)
+    LARGE_INTEGER   freq, cnt;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&cnt);
+    return (uint64_t) ((cnt.QuadPart / freq.QuadPart) * 1000000 + ((cnt.QuadPart % freq.QuadPart) * 1000000) / freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec) * 1000000 + ((uint64_t) ts.tv_nsec) / 1000;
+#endif
+}
+
+
+
+
+/**
+ *  @brief Sleep
+ *
+ *  suspends execution
+ *
+ *  @param[in]      us                  time in us
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_sleep_us( uint32_t us )
+{
+#if defined(_WIN32)
+    Sleep((DWORD) ((us + 999) / 1000));
+#else
+    struct timespec ts;
+    ts.tv_sec = (time_t) (us / 1000000);
+    ts.tv_nsec = (long) ((us % 1000000) * 1000);
+    nanosleep(&ts, NULL);
+#endif
+}
+
+
+
 
 /**
  *  @brief UART Write
@@ -187,6 +282,61 @@ static void usbiss_uint8_to_asciihex( char *buf, uint32_t buflen, uint8_t *dat,
 
 
 
+/**
+ *  @brief segment length
+ *
+ *  @param[in]      iov                 write segments
+ *  @param[in]      iovNum              number of segments
+ *  @return         size_t              number of bytes in all segments
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static size_t usbiss_iov_len( const t_usbiss_iovec *iov, size_t iovNum )
+{
+    /** Variables **/
+    size_t  len = 0;    // sum of segments
+
+    for ( size_t i = 0; i < iovNum; i++ ) {
+        len += iov[i].len;
+    }
+    return len;
+}
+
+
+
+/**
+ *  @brief segment copy
+ *
+ *  gathers byte range of segments into contiguous buffer
+ *
+ *  @param[out]     dst                 destination
+ *  @param[in]      iov                 write segments
+ *  @param[in]      iovNum              number of segments
+ *  @param[in]      ofs                 first byte of range
+ *  @param[in]      len                 number of bytes, range within segments
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_iov_copy( void* dst, const t_usbiss_iovec *iov, size_t iovNum, size_t ofs, size_t len )
+{
+    /** Variables **/
+    size_t  num;        // bytes from current segment
+
+    for ( size_t i = 0; (i < iovNum) && (0 != len); i++ ) {
+        if ( ofs >= iov[i].len ) {
+            ofs -= iov[i].len;
+            continue;
+        }
+        num = usbiss_min(iov[i].len - ofs, len);
+        memcpy(dst, (const uint8_t*) iov[i].base + ofs, num);
+        dst = (uint8_t*) dst + num;
+        len -= num;
+        ofs = 0;
+    }
+}
+
+
+
 /**
  *  mode-to-str
  *    converts USBISS mode to human readable string
@@ -264,6 +414,141 @@ static uint32_t usbiss_uart_free( t_usbiss *self )
 
 
 
+/**
+ *  @brief UART read with timeout
+ *
+ *  Read from UART port until requested bytes are received or no byte arrived
+ *  within the timeout
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      data                array with read data
+ *  @param[in]      len                 requested number of bytes
+ *  @param[in]      tmoUs               timeout in us, restarted with every received byte
+ *  @return         uint32_t            number of read bytes
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint32_t usbiss_uart_read_tmo( t_usbiss *self, void* data, uint32_t len, uint32_t tmoUs )
+{
+    /** Variables **/
+    uint32_t    r = 0;                          // number of recieved bytes
+    uint32_t    avail;                          // available bytes in UART
+    uint64_t    uint64Last = usbiss_time_us();  // time of last received byte
+
+    /* read until requested or quiet */
+    while ( r < len ) {
+        avail = usbiss_uart_read_avail(self);
+        if ( 0 != avail ) {
+            r += usbiss_uart_read(self, (uint8_t*) data + r, usbiss_min(avail, len - r));
+            uint64Last = usbiss_time_us();
+            continue;
+        }
+        if ( usbiss_time_us() - uint64Last > tmoUs ) {
+            break;
+        }
+        usbiss_sleep_us(USBISS_RESYNC_POLL_US);
+    }
+    return r;
+}
+
+
+
+/**
+ *  usbiss_resync
+ *    align UART stream to USB-ISS response frames
+ */
+int usbiss_resync( t_usbiss *self )
+{
+    /** Variables **/
+    uint8_t     uint8Wr[2];     // version request
+    uint8_t     uint8Rd[4];     // sliding window of response
+    uint8_t     uint8Drop[16];  // drained bytes
+    uint32_t    uint32Drop = 0; // number of dropped bytes
+    uint32_t    uint32Len;      // read bytes
+    uint64_t    uint64Start;    // start of drain
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* USBISS open? */
+    if ( !self->uint8IsOpen ) {
+        return -1;
+    }
+    ++(self->uint32Resync);
+    /* drain until line is quiet, slow trailing bytes are captured too */
+    uint64Start = usbiss_time_us();
+    do {
+        uint32Len = usbiss_uart_read_tmo(self, uint8Drop, sizeof(uint8Drop), USBISS_RESYNC_QUIET_US);
+        uint32Drop += uint32Len;
+    } while ( (0 != uint32Len) && (usbiss_time_us() - uint64Start < USBISS_RESYNC_TMO_US) );
+    /* probe with version request, answer has known format */
+    for ( uint8_t i = 0; i < USBISS_RESYNC_PROBE; i++ ) {
+        uint8Wr[0] = USBISS_CMD;
+        uint8Wr[1] = USBISS_ISS_VERSION;
+        if ( 2 != usbiss_uart_write(self, uint8Wr, 2) ) {
+            break;
+        }
+        /* search for ID + FW, bytes in front belong to stale responses */
+        uint32Len = usbiss_uart_read_tmo(self, uint8Rd, 3, USBISS_RESYNC_TMO_US);
+        while ( 3 == uint32Len ) {
+            if ( (USBISS_ID == uint8Rd[0]) && (self->uint8Fw == uint8Rd[1]) && (0 == usbiss_uart_read_avail(self)) ) {
+                self->uint8Mode = uint8Rd[2];   // adapter is source of truth
+                if ( 0 != self->uint8MsgLevel ) {
+                    printf("  INFO:%s: aligned, dropped %u bytes, probe %i\n", __FUNCTION__, uint32Drop, i);
+                }
+                return 0;
+            }
+            uint8Rd[0] = uint8Rd[1];
+            uint8Rd[1] = uint8Rd[2];
+            ++uint32Drop;
+            uint32Len = 2 + usbiss_uart_read_tmo(self, uint8Rd+2, 1, USBISS_RESYNC_QUIET_US);
+        }
+        /* drop remainder before next probe */
+        uint32Drop += usbiss_uart_free(self);
+    }
+    /* not aligned */
+    ++(self->uint32ResyncFail);
+    if ( 0 != self->uint8MsgLevel ) {
+        printf("  ERROR:%s: USB-ISS not responding properly\n", __FUNCTION__);
+    }
+    return -1;
+}
+
+
+
+/**
+ *  @brief stale response
+ *
+ *  checks USB-ISS status bytes for plausibility, a status other than ACK/NACK
+ *  or an unknown error code belongs to a stale response. In this case the
+ *  UART stream is re-synced.
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      rsp                 status bytes of response
+ *  @return         int
+ *  @retval         0                   plausible response
+ *  @retval         1                   stale response, stream re-synced
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_rsp_stale( t_usbiss *self, uint8_t *rsp )
+{
+    /* plausible */
+    if ( USBISS_CMD_ACK == rsp[0] ) {
+        return 0;
+    }
+    if ( (USBISS_CMD_NCK == rsp[0]) && (USBISS_ERO_ID1 <= rsp[1]) && (USBISS_ERO_ID7 >= rsp[1]) ) {
+        return 0;
+    }
+    /* misaligned */
+    if ( 0 != self->uint8MsgLevel ) {
+        printf("  ERROR:%s: implausible status 0x%02x 0x%02x, re-sync\n", __FUNCTION__, rsp[0], rsp[1]);
+    }
+    usbiss_resync(self);
+    return 1;
+}
+
+
+
 /**
  *  @brief I2C Startbit
  *
@@ -310,6 +595,9 @@ static int usbiss_i2c_startbit( t_usbiss *self, uint8_t adr8 )
         }
         return -1;
     }
+    if ( 0 != usbiss_rsp_stale(self, uint8Rd) ) {
+        return -1;  // response of other request, stream re-synced
+    }
     if ( USBISS_CMD_ACK != uint8Rd[0] ) {
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s: Start bit rejected, %s, ero=0x%02x\n", __FUNCTION__, usbiss_ero_str(uint8Rd[1]), uint8Rd[1]);
@@ -368,6 +656,9 @@ static int usbiss_i2c_restartbit( t_usbiss *self, uint8_t adr8 )
         }
         return -1;
     }
+    if ( 0 != usbiss_rsp_stale(self, uint8Rd) ) {
+        return -1;  // response of other request, stream re-synced
+    }
     if ( USBISS_CMD_ACK != uint8Rd[0] ) {
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s: Start bit rejected, %s, ero=0x%02x\n", __FUNCTION__, usbiss_ero_str(uint8Rd[1]), uint8Rd[1]);
@@ -422,6 +713,9 @@ static int usbiss_i2c_stopbit( t_usbiss *self )
         }
         return -1;
     }
+    if ( 0 != usbiss_rsp_stale(self, uint8Rd) ) {
+        return -1;  // response of other request, stream re-synced
+    }
     if ( USBISS_CMD_ACK != uint8Rd[0] ) {
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s: Stop bit rejected, %s, ero=0x%02x\n", __FUNCTION__, usbiss_ero_str(uint8Rd[1]), uint8Rd[1]);
@@ -437,18 +731,19 @@ static int usbiss_i2c_stopbit( t_usbiss *self )
 /**
  *  @brief I2C data write
  *
- *  brings only data bytes to I2C lines, Start/Stop bit needs to asserted by dedicated function
+ *  brings only data bytes to I2C lines, Start/Stop bit needs to asserted by dedicated function,
+ *  packets are filled straight from the write segments
  *
  *  @param[in,out]  *self               common handle #t_usbiss
- *  @param[in]      data                data array
- *  @param[in]      len                 number of bytes in data
+ *  @param[in]      iov                 write segments
+ *  @param[in]      iovNum              number of segments
  *  @return         int
  *  @retval         0                   OK
  *  @retval         -1                  FAIL
  *  @since          July 10, 2023
  *  @author         Andreas Kaeberlein
  */
-static int usbiss_i2c_data_wr ( t_usbiss *self, void* data, size_t len )
+static int usbiss_i2c_data_wr ( t_usbiss *self, const t_usbiss_iovec *iov, size_t iovNum )
 {
     /** Variables **/
     uint8_t     uint8Wr[32];    // write buffer: DIRECT + START + WRITE + 16Bytes + STOP
@@ -460,25 +755,38 @@ static int usbiss_i2c_data_wr ( t_usbiss *self, void* data, size_t len )
     char        charBuf[256];   // help buffer for debug outputs
     int         intRet;         // internal return code, allows to send stop bit in case of crash
     size_t      iter;           // loop count
+    size_t      seg;            // current segment
+    size_t      segOfs;         // byte offset in current segment
+    size_t      num;            // bytes from current segment
 
     /* Function Call Message */
     if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
     /* empty frame provided */
-    if ( 0 == len ) {
+    bytesPend = usbiss_iov_len(iov, iovNum);    // all bytes pending
+    if ( 0 == bytesPend ) {
         return 0;
     }
     /* Data Packets to line */
     intRet = 0;
     iter = 0;
     dataOfs = 0;    // next data packet start field
-    bytesPend = len;    // all bytes pending
+    seg = 0;
+    segOfs = 0;
     while ( bytesPend > 0 ) {
         /* calc payload size */
         uint8Chunk = (uint8_t) usbiss_min((size_t) USBISS_I2C_CHUNK, bytesPend);    // calculate max number of bytes to send, -1 through i2c adr
         /* assemble packet */
         uint8Wr[0] = USBISS_I2C_DIRECT; // USBISS direct mode
         uint8Wr[1] = (uint8_t) (USBISS_I2C_WRITE + uint8Chunk - 1);
-        memcpy(uint8Wr+2, data+dataOfs, uint8Chunk);
+        for ( size_t i = 0; i < uint8Chunk; i += num ) {
+            while ( segOfs >= iov[seg].len ) {  // skip consumed and empty segments
+                ++seg;
+                segOfs = 0;
+            }
+            num = usbiss_min(iov[seg].len - segOfs, (size_t) uint8Chunk - i);
+            memcpy(uint8Wr+2+i, (const uint8_t*) iov[seg].base + segOfs, num);
+            segOfs += num;
+        }
         /* request i2c packet transfer */
         if ( ((uint32_t) (uint8Chunk + 2)) != usbiss_uart_write(self, uint8Wr, (uint32_t) (uint8Chunk + 2)) ) { // request
             if ( 0 != self->uint8MsgLevel ) {
@@ -501,6 +809,9 @@ static int usbiss_i2c_data_wr ( t_usbiss *self, void* data, size_t len )
             intRet = -1;
             break;
         }
+        if ( 0 != usbiss_rsp_stale(self, uint8Rd) ) {
+            return -1;  // response of other request, stream re-synced
+        }
         if ( USBISS_CMD_ACK != uint8Rd[0] ) {
             if ( 0 != self->uint8MsgLevel ) {
                 printf("  ERROR:%s:PKG=%zi: packet rejected, %s, ero=0x%02x\n", __FUNCTION__, iter, usbiss_ero_str(uint8Rd[1]), uint8Rd[1]);
@@ -552,6 +863,7 @@ static int usbiss_i2c_data_rd ( t_usbiss *self, void* data, size_t len )
         return 0;
     }
     /* request ACK Bytes, last byte need NCK */
+    self->sizeRdDone = 0;
     dataOfs = 0;
     iter = 0;
     if ( len > 1 ) {
@@ -576,9 +888,13 @@ static int usbiss_i2c_data_rd ( t_usbiss *self, void* data, size_t len )
                 if ( 0 != self->uint8MsgLevel ) {
                     printf("  ERROR:%s:PKG=%zi:RSP:STATUS: Unexpected number of %i instead %i bytes received\n", __FUNCTION__, iter, uint32RdLen, 2);
                 }
+                usbiss_resync(self);    // align stream again
                 return -1;
             }
             /* check response byte */
+            if ( 0 != usbiss_rsp_stale(self, uint8Rd) ) {
+                return -1;  // response of other request, stream re-synced
+            }
             if ( USBISS_CMD_ACK != uint8Rd[0] ) {
                 if ( 0 != self->uint8MsgLevel ) {
                     printf("  ERROR:%s:PKG=%zi: packet rejected, %s, ero=0x%02x\n", __FUNCTION__, iter, usbiss_ero_str(uint8Rd[1]), uint8Rd[1]);
@@ -590,7 +906,7 @@ static int usbiss_i2c_data_rd ( t_usbiss *self, void* data, size_t len )
                 if ( 0 != self->uint8MsgLevel ) {
                     printf("  ERROR:%s:PKG=%zi: wrong data count recieved, exp=%i, is=%i\n", __FUNCTION__, iter, uint8Chunk, uint8Rd[1]);
                 }
-                usbiss_uart_free(self); // clean buffer
+                usbiss_resync(self);    // align stream again
                 return -1;
             }
             /* UART data read: get payload with data */
@@ -599,6 +915,7 @@ static int usbiss_i2c_data_rd ( t_usbiss *self, void* data, size_t len )
                 if ( 0 != self->uint8MsgLevel ) {
                     printf("  ERROR:%s:PKG=%zi:RSP:DATA: Unexpected number of %i instead %i bytes received\n", __FUNCTION__, iter, uint32RdLen, uint8Chunk);
                 }
+                usbiss_resync(self);    // align stream again
                 return -1;
             }
             /* user message */
@@ -610,6 +927,7 @@ static int usbiss_i2c_data_rd ( t_usbiss *self, void* data, size_t len )
             memcpy(data+dataOfs, uint8Rd+2, uint8Chunk);
             /* prepare next cycle */
             dataOfs = dataOfs + ((size_t) uint8Chunk);  // update data pointer
+            self->sizeRdDone = dataOfs;                 // progress for chunk resume
             ackBytesPend = ackBytesPend - uint8Chunk;   // update count of pending bytes
             iter++;
         }
@@ -632,9 +950,13 @@ static int usbiss_i2c_data_rd ( t_usbiss *self, void* data, size_t len )
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s:PKG=%zi:RSP:STATUS Unexpected number of %i instead %i bytes received\n", __FUNCTION__, iter, uint32RdLen, 2);
         }
+        usbiss_resync(self);    // align stream again
         return -1;
     }
     /* check response byte */
+    if ( 0 != usbiss_rsp_stale(self, uint8Rd) ) {
+        return -1;  // response of other request, stream re-synced
+    }
     if ( USBISS_CMD_ACK != uint8Rd[0] ) {
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s:PKG=%zi: packet rejected, %s, ero=0x%02x\n", __FUNCTION__, iter, usbiss_ero_str(uint8Rd[1]), uint8Rd[1]);
@@ -646,7 +968,7 @@ static int usbiss_i2c_data_rd ( t_usbiss *self, void* data, size_t len )
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s:PKG=%zi: wrong data count recieved, exp=%i, is=%i\n", __FUNCTION__, iter, 1, uint8Rd[1]);
         }
-        usbiss_uart_free(self); // clean buffer
+        usbiss_resync(self);    // align stream again
         return -1;
     }
     /* UART data read: get payload with data */
@@ -655,6 +977,7 @@ static int usbiss_i2c_data_rd ( t_usbiss *self, void* data, size_t len )
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s:PKG=%zi:RSP:DATA: Unexpected number of %i instead %i bytes received\n", __FUNCTION__, iter, uint32RdLen, 1);
         }
+        usbiss_resync(self);    // align stream again
         return -1;
     }
     /* user message */
@@ -664,6 +987,7 @@ static int usbiss_i2c_data_rd ( t_usbiss *self, void* data, size_t len )
     }
     /* fill data in result variable */
     memcpy(data+dataOfs, uint8Rd+2, 1);
+    self->sizeRdDone = dataOfs + 1;
     /* finish function */
     return 0;
 }
@@ -743,10 +1067,19 @@ int usbiss_is_i2c_mode( uint8_t mode )
 
 
 /**
- *  usbiss_list_uart
- *    List suitable port for USB-ISS connection
+ *  @brief list UART ports by description
+ *
+ *  Lists USB-ISS UART ports based on the port description of simple uart
+ *
+ *  @param[in,out]  uart                USB-ISS matching UART ports
+ *  @param[in]      len                 maximum string length
+ *  @param[in]      sep                 separator between suitable ports
+ *  @param[in]      serial              USB serial number of port, NULL for all
+ *  @return         int                 number of USB-ISS matching ports
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
  */
-int usbiss_list_uart( char *uart, size_t len, const char sep[] )
+static int usbiss_describe_list( char *uart, size_t len, const char sep[], const char* serial )
 {
     /** Variables **/
     char    **names;
@@ -792,6 +1125,13 @@ int usbiss_list_uart( char *uart, size_t len, const char sep[] )
                 strncpy(chrVid, pHelp + 4, 4);
                 chrVid[4] = '\0';
             }
+            /* serial match? */
+            if ( NULL != serial ) {
+                pHelp = strstr(decription, "serial=");
+                if ( (NULL == pHelp) || (0 != strncmp(pHelp + 7, serial, strlen(serial))) || (isalnum((unsigned char) pHelp[7+strlen(serial)])) ) {
+                    continue;
+                }
+            }
             /* VID/PID match? */
             if ( (0 == strcasecmp(chrVid, USBISS_VCP_VID)) && (0 == strcasecmp(chrPid, USBISS_VCP_PID)) ) {
                 snprintf(uart+strlen(uart), len-strlen(uart), "%s%s", names[i], sep);
@@ -816,66 +1156,421 @@ int usbiss_list_uart( char *uart, size_t len, const char sep[] )
 
 
 
+#if defined(__linux__)
 /**
- *  usbiss_init
- *    initializes common data structure
+ *  @brief sysfs attribute
+ *
+ *  reads attribute of USB device belonging to tty from sysfs
+ *
+ *  @param[in]      tty                 tty name, f.e. ttyACM0
+ *  @param[in]      attr                USB device attribute, f.e. idVendor
+ *  @param[out]     val                 attribute value
+ *  @param[in]      len                 maximum string length of val
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
  */
-int usbiss_init( t_usbiss *self )
+static int usbiss_sysfs_attr( const char* tty, const char* attr, char* val, size_t len )
 {
-    /* init variable */
-    self->uint8MsgLevel = 0;    // suppress all outputs
-    self->uint32BaudRate = USBISS_UART_BAUD_RATE;   // default baudrate
-    self->uint8Fw = 0;          // firmware version
-    self->uint8Mode = 0;        // transfer mode
-    self->uint8IsOpen = 0;      // not open
-    (self->charPort)[0] = '\0'; // no port provided
-    /* graceful end */
+    /** Variables **/
+    char    charPath[256];  // attribute path
+    FILE*   fh;             // file handle
+
+    /* device link points to USB interface, attributes are in USB device */
+    snprintf(charPath, sizeof(charPath), "/sys/class/tty/%s/device/../%s", tty, attr);
+    fh = fopen(charPath, "r");
+    if ( NULL == fh ) {
+        return -1;
+    }
+    if ( NULL == fgets(val, (int) len, fh) ) {
+        fclose(fh);
+        return -1;
+    }
+    fclose(fh);
+    val[strcspn(val, "\r\n")] = '\0';
     return 0;
 }
 
 
+
 /**
- *  usbiss_set_verbose
- *    set verbose level
+ *  @brief list UART ports by sysfs
+ *
+ *  Lists USB-ISS UART ports in one pass over sysfs, no port is opened
+ *
+ *  @param[in,out]  uart                USB-ISS matching UART ports
+ *  @param[in]      len                 maximum string length
+ *  @param[in]      sep                 separator between suitable ports
+ *  @param[in]      serial              USB serial number of port, NULL for all
+ *  @return         int                 number of USB-ISS matching ports
+ *  @retval         -1                  sysfs not available
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
  */
-void usbiss_set_verbose( t_usbiss *self, uint8_t verbose )
+static int usbiss_sysfs_list( char *uart, size_t len, const char sep[], const char* serial )
 {
-    self->uint8MsgLevel = verbose;
+    /** Variables **/
+    DIR*            dir;            // tty class directory
+    struct dirent*  ent;            // tty entry
+    char            charVid[8];     // vendor id
+    char            charPid[8];     // product id
+    char            charSerial[32]; // serial number
+    int             intNum = 0;     // number of USB-ISS ports
+
+    /* make empty */
+    uart[0] = '\0';
+    /* iterate over ttys */
+    dir = opendir("/sys/class/tty");
+    if ( NULL == dir ) {
+        return -1;
+    }
+    while ( NULL != (ent = readdir(dir)) ) {
+        /* in linux has USB-ISS the uart port ttyACM* */
+        if ( 0 != strncmp(ent->d_name, "ttyACM", 6) ) {
+            continue;
+        }
+        /* VID/PID match? */
+        if ( (0 != usbiss_sysfs_attr(ent->d_name, "idVendor", charVid, sizeof(charVid))) || (0 != strcasecmp(charVid, USBISS_VCP_VID)) ) {
+            continue;
+        }
+        if ( (0 != usbiss_sysfs_attr(ent->d_name, "idProduct", charPid, sizeof(charPid))) || (0 != strcasecmp(charPid, USBISS_VCP_PID)) ) {
+            continue;
+        }
+        /* serial match? */
+        if ( NULL != serial ) {
+            if ( (0 != usbiss_sysfs_attr(ent->d_name, "serial", charSerial, sizeof(charSerial))) || (0 != strcmp(charSerial, serial)) ) {
+                continue;
+            }
+        }
+        snprintf(uart+strlen(uart), len-strlen(uart), "%s/dev/%s", (0 != intNum) ? sep : "", ent->d_name);
+        ++intNum;
+    }
+    closedir(dir);
+    /* finish */
+    return intNum;
 }
+#endif
+
 
 
 /**
- *  usbiss_open
- *    open handle to USBISS and checks ID + serial read
+ *  @brief UART port serial
+ *
+ *  acquires USB serial number of USB-ISS UART port without opening the port
+ *
+ *  @param[in]      port                UART port, f.e. /dev/ttyACM0
+ *  @param[out]     serial              USB serial number
+ *  @param[in]      len                 maximum string length of serial
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
  */
-int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
+static int usbiss_port_serial( const char* port, char* serial, size_t len )
 {
-    /** variable **/
-    uint8_t     uint8Wr[16];        // write buffer
-    uint8_t     uint8Rd[16];        // read buffer
-    uint32_t    uint32RdLen;        // length of read buffer
-    char        charBuf[16];        // string buffer
-    char        charUartAuto[256];  // autodedect USB-ISS uart port
-    char*       charPtrFirstUart;   // pointer to first UART port
-    int         intNumUarts;        // number of UART ports in system
+#if defined(__linux__)
+    /** Variables **/
+    const char* charPtrTty = strrchr(port, '/');    // tty name
 
-    /* Function Call Message */
-    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
-    /* no autodetect path provided? */
-    if ( '\0' != port[0] ) {
-        if ( strlen(port) > (sizeof(self->charPort) - 1) ) {
-            if ( 0 != self->uint8MsgLevel ) {
-                printf("  ERROR:%s: UART port path too long.\n", __FUNCTION__);
+    charPtrTty = (NULL == charPtrTty) ? port : charPtrTty + 1;
+    return usbiss_sysfs_attr(charPtrTty, "serial", serial, len);
+#else
+    /** Variables **/
+    char        decription[1024];   // uart port description
+    const char* pHelp;              // help pointer
+
+    if ( 0 != simple_uart_describe(port, decription, sizeof(decription)) ) {
+        return -1;
+    }
+    pHelp = strstr(decription, "serial=");
+    if ( NULL == pHelp ) {
+        return -1;
+    }
+    snprintf(serial, len, "%.*s", (int) strcspn(pHelp + 7, ",' \r\n"), pHelp + 7);
+    return 0;
+#endif
+}
+
+
+
+/**
+ *  @brief replace file lines
+ *
+ *  rewrites a text file, all lines starting with key are removed and text is appended
+ *
+ *  @param[in]      path                file path
+ *  @param[in]      key                 first token of lines to remove
+ *  @param[in]      text                appended text
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_file_replace( const char* path, const char* key, const char* text )
+{
+    /** Variables **/
+    FILE*   fh;             // file handle
+    char*   charPtrOld;     // old file content
+    long    lngSize = 0;    // old file size
+    char*   charPtrLine;    // line in old file
+    char    charKey[64];    // key of old line
+
+    /* read old file content */
+    charPtrOld = NULL;
+    fh = fopen(path, "r");
+    if ( NULL != fh ) {
+        if ( 0 == fseek(fh, 0, SEEK_END) ) {
+            lngSize = ftell(fh);
+            rewind(fh);
+        }
+        if ( 0 < lngSize ) {
+            charPtrOld = calloc((size_t) lngSize + 1, 1);
+            if ( NULL != charPtrOld ) {
+                lngSize = (long) fread(charPtrOld, 1, (size_t) lngSize, fh);
             }
-            return -1;
         }
-        strncpy(self->charPort, port, sizeof(self->charPort));
-    } else {    // consider first found UART device in system as USB-ISS uart port
-        /* get available USB-ISS suitable ports from system */
-        intNumUarts = usbiss_list_uart(charUartAuto, sizeof(charUartAuto), " ");
-        /* select Port */
-        switch (intNumUarts) {
-            /* no UART */
+        fclose(fh);
+    }
+    /* write new file */
+    fh = fopen(path, "w");
+    if ( NULL == fh ) {
+        free(charPtrOld);
+        return -1;
+    }
+    /* keep lines of other keys */
+    if ( NULL != charPtrOld ) {
+        charPtrLine = strtok(charPtrOld, "\n");
+        while ( NULL != charPtrLine ) {
+            if ( (1 == sscanf(charPtrLine, "%63s", charKey)) && (0 != strcmp(charKey, key)) ) {
+                fprintf(fh, "%s\n", charPtrLine);
+            }
+            charPtrLine = strtok(NULL, "\n");
+        }
+        free(charPtrOld);
+    }
+    fputs(text, fh);
+    fclose(fh);
+    /* graceful end */
+    return 0;
+}
+
+
+
+/**
+ *  @brief handshake cache read
+ *
+ *  gets serial number and firmware of USB-ISS at self->charPort from
+ *  handshake cache, USB serial is taken from the system
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  no valid entry
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_cache_get( t_usbiss *self )
+{
+    /** Variables **/
+    FILE*   fh;             // file handle
+    char    charLine[128];  // line buffer
+    char    charSerial[32]; // USB serial of port
+    char    charKey[32];    // serial in cache
+    int     intFw;          // firmware in cache
+
+    /* serial of port */
+    if ( 0 != usbiss_port_serial(self->charPort, charSerial, sizeof(charSerial)) ) {
+        return -1;
+    }
+    /* look up */
+    fh = fopen(self->charCache, "r");
+    if ( NULL == fh ) {
+        return -1;
+    }
+    while ( NULL != fgets(charLine, sizeof(charLine), fh) ) {
+        if ( (2 == sscanf(charLine, "%31s %i", charKey, &intFw)) && (0 == strcmp(charKey, charSerial)) && (USBISS_FW_MIN <= intFw) ) {
+            fclose(fh);
+            memset(self->charSerial, 0, sizeof(self->charSerial));
+            strncpy(self->charSerial, charSerial, sizeof(self->charSerial) - 1);
+            self->uint8Fw = (uint8_t) intFw;
+            return 0;
+        }
+    }
+    fclose(fh);
+    return -1;
+}
+
+
+
+/**
+ *  usbiss_list_uart
+ *    List suitable port for USB-ISS connection
+ */
+int usbiss_list_uart( char *uart, size_t len, const char sep[] )
+{
+#if defined(__linux__)
+    /** Variables **/
+    int intNum;
+
+    /* fast path, USB attributes from sysfs */
+    intNum = usbiss_sysfs_list(uart, len, sep, NULL);
+    if ( 0 <= intNum ) {
+        return intNum;
+    }
+#endif
+    return usbiss_describe_list(uart, len, sep, NULL);
+}
+
+
+
+/**
+ *  usbiss_find_uart
+ *    find UART port of USB-ISS by USB serial number
+ */
+int usbiss_find_uart( const char* serial, char* port, size_t len )
+{
+    /** Variables **/
+    char    charUart[256];  // matching ports
+    int     intNum = -1;    // number of matching ports
+
+#if defined(__linux__)
+    intNum = usbiss_sysfs_list(charUart, sizeof(charUart), " ", serial);
+#endif
+    if ( 0 > intNum ) {
+        intNum = usbiss_describe_list(charUart, sizeof(charUart), " ", serial);
+    }
+    if ( !(0 < intNum) ) {
+        return -1;
+    }
+    charUart[strcspn(charUart, " ")] = '\0';    // first match
+    if ( !(strlen(charUart) < len) ) {
+        return -1;
+    }
+    strncpy(port, charUart, len);
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_init
+ *    initializes common data structure
+ */
+int usbiss_init( t_usbiss *self )
+{
+    /* init variable */
+    self->uint8MsgLevel = 0;    // suppress all outputs
+    self->uint32BaudRate = USBISS_UART_BAUD_RATE;   // default baudrate
+    self->uint8Fw = 0;          // firmware version
+    self->uint8Mode = 0;        // transfer mode
+    self->uint8IsOpen = 0;      // not open
+    (self->charPort)[0] = '\0'; // no port provided
+    self->uint8ModeDflt = __UINT8_MAX__;    // no default mode
+    memset(self->uint8I2cClk, USBISS_IO_MODE, sizeof(self->uint8I2cClk));   // no I2C clock profiles
+    self->uint32ModeSwitch = 0; // no mode change requested
+    self->retry.uint8Attempts = 1;  // no retry
+    self->retry.uint32BackoffUs = 1000;
+    self->retry.uint8BackoffMul = 2;
+    self->retry.uint32BackoffMaxUs = 100000;
+    self->retry.uint16Retryable = USBISS_RETRY_ERO_DFLT;
+    self->retry.uint8Resume = USBISS_RETRY_XFER;
+    self->retry.uint8Recover = 0;
+    self->uint32Retry = 0;
+    self->uint32Recover = 0;
+    self->sizeRdDone = 0;
+    self->uint32Resync = 0;
+    self->uint32ResyncFail = 0;
+    self->charCache[0] = '\0';
+    self->uint8Hotplug = 0;     // no reconnect
+    self->intHotplugFd = -1;
+    self->uint8Lost = 0;
+    self->uint8ModeRestore = __UINT8_MAX__;
+    self->uint8ModeDfltRestore = __UINT8_MAX__;
+    self->uint64HotplugTry = 0;
+    self->uint32Reconnect = 0;
+    self->charUsbSerial[0] = '\0';
+    for ( uint8_t i = 0; i < USBISS_I2C_NUM_ADR; i++ ) {
+        self->regcache[i] = NULL;   // no register cache
+    }
+    self->uint32CacheHit = 0;
+    self->uint32CacheMiss = 0;
+    self->uint32CacheWrBuf = 0;
+    self->uint32CacheBurst = 0;
+    self->uint64CacheFlush = 0;     // no buffered writes
+    self->intCacheEro = 0;
+    self->uint32PackFrame = 0;
+    self->uint32PackXfer = 0;
+    self->uint32PackFallback = 0;
+    memset(self->uint8NoPack, 0, sizeof(self->uint8NoPack));    // all slaves packable
+    self->uint8MuxNum = 0;          // no multiplexer
+    self->uint32MuxSel = 0;
+    self->uint32MuxHit = 0;
+    /* graceful end */
+    return 0;
+}
+
+
+/**
+ *  usbiss_set_verbose
+ *    set verbose level
+ */
+void usbiss_set_verbose( t_usbiss *self, uint8_t verbose )
+{
+    self->uint8MsgLevel = verbose;
+}
+
+
+/**
+ *  usbiss_set_retry
+ *    set retry policy
+ */
+void usbiss_set_retry( t_usbiss *self, const t_usbiss_retry *retry )
+{
+    self->retry = *retry;
+    if ( 0 == self->retry.uint8Attempts ) {
+        self->retry.uint8Attempts = 1;  // at least one attempt
+    }
+}
+
+
+/**
+ *  usbiss_open
+ *    open handle to USBISS and checks ID + serial read
+ */
+int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
+{
+    /** variable **/
+    uint8_t     uint8Wr[16];        // write buffer
+    uint8_t     uint8Rd[16];        // read buffer
+    uint32_t    uint32RdLen;        // length of read buffer
+    char        charBuf[16];        // string buffer
+    char        charUartAuto[256];  // autodedect USB-ISS uart port
+    char*       charPtrFirstUart;   // pointer to first UART port
+    int         intNumUarts;        // number of UART ports in system
+    char        charSerUsb[32];     // USB serial of port
+    char        charCacheLine[64];  // handshake cache entry
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* no autodetect path provided? */
+    if ( '\0' != port[0] ) {
+        if ( strlen(port) > (sizeof(self->charPort) - 1) ) {
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  ERROR:%s: UART port path too long.\n", __FUNCTION__);
+            }
+            return -1;
+        }
+        strncpy(self->charPort, port, sizeof(self->charPort));
+    } else {    // consider first found UART device in system as USB-ISS uart port
+        /* get available USB-ISS suitable ports from system */
+        intNumUarts = usbiss_list_uart(charUartAuto, sizeof(charUartAuto), " ");
+        /* select Port */
+        switch (intNumUarts) {
+            /* no UART */
             case 0:
                 if ( 0 != self->uint8MsgLevel ) {
                     printf("  ERROR:%s: no USB-ISS suitable port found.\n", __FUNCTION__);
@@ -937,6 +1632,16 @@ int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
     }
     /* check if there are no pending bytes in UART */
     usbiss_uart_free(self);
+    /* known adapter, skip handshake */
+    if ( ('\0' != self->charCache[0]) && (0 == usbiss_cache_get(self)) ) {
+        self->uint8Mode = __UINT8_MAX__;        // unknown, next usbiss_set_mode requests
+        self->uint8ModeDflt = __UINT8_MAX__;
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  INFO:%s: cached FW=0x%02x, Serial=%s\n", __FUNCTION__, self->uint8Fw, self->charSerial);
+        }
+        self->uint8IsOpen = 1;
+        return 0;
+    }
     /* check module id */
     uint8Wr[0] = USBISS_CMD;
     uint8Wr[1] = USBISS_ISS_VERSION;
@@ -945,6 +1650,7 @@ int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
             usbiss_uint8_to_asciihex(charBuf, sizeof(charBuf), uint8Wr, 2); // convert to ascii
             printf("  ERROR:%s: REQ: %s\n", __FUNCTION__, charBuf);
         }
+        simple_uart_close(self->uart);
         return -1;
     }
     uint32RdLen = usbiss_uart_read(self, uint8Rd, 3);
@@ -952,6 +1658,7 @@ int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s: Unexpected number of %i bytes received\n", __FUNCTION__, uint32RdLen);
         }
+        simple_uart_close(self->uart);
         return -1;
     }
     if ( 0 != self->uint8MsgLevel ) {
@@ -961,15 +1668,18 @@ int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s: Unexpected module id 0x%02x\n", __FUNCTION__, uint8Rd[0]);
         }
+        simple_uart_close(self->uart);
         return -1;
     }
     self->uint8Fw = uint8Rd[1];     // USB-ISS firmware revision
     self->uint8Mode = uint8Rd[2];   // current transfer mode
+    self->uint8ModeDflt = uint8Rd[2];   // slaves without clock profile use power-on mode
     /* check for proper firmware revision, ISC_DIRECT is needed */
     if ( USBISS_FW_MIN > self->uint8Fw ) {
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s: Installed USB-ISS FW=0x%02x, Required 0x%02x. Please do an FW update.\n", __FUNCTION__, self->uint8Fw, USBISS_FW_MIN);
         }
+        simple_uart_close(self->uart);
         return -1;
     }
     /* Get Serial number */
@@ -980,6 +1690,7 @@ int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
             usbiss_uint8_to_asciihex(charBuf, sizeof(charBuf), uint8Wr, 2); // convert to ascii
             printf("  ERROR:%s: REQ: %s\n", __FUNCTION__, charBuf);
         }
+        simple_uart_close(self->uart);
         return -1;
     }
     uint32RdLen = usbiss_uart_read(self, uint8Rd, 8);
@@ -987,6 +1698,7 @@ int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s: Unexpected number of %i bytes received\n", __FUNCTION__, uint32RdLen);
         }
+        simple_uart_close(self->uart);
         return -1;
     }
     memset(self->charSerial, 0, sizeof(self->charSerial));  // make empty string
@@ -994,6 +1706,15 @@ int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
     if ( 0 != self->uint8MsgLevel ) {
         printf("  INFO:%s: Serial=%s\n", __FUNCTION__, self->charSerial);
     }
+    /* remember handshake */
+    if ( ('\0' != self->charCache[0]) && (0 == usbiss_port_serial(self->charPort, charSerUsb, sizeof(charSerUsb))) ) {
+        snprintf(charCacheLine, sizeof(charCacheLine), "%s 0x%02x\n", charSerUsb, self->uint8Fw);
+        if ( 0 != usbiss_file_replace(self->charCache, charSerUsb, charCacheLine) ) {
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  WARNING:%s: write handshake cache '%s'\n", __FUNCTION__, self->charCache);
+            }
+        }
+    }
     /* mark as open */
     self->uint8IsOpen = 1;
     /* graceful end */
@@ -1002,6 +1723,52 @@ int usbiss_open( t_usbiss *self, char* port, uint32_t baud )
 
 
 
+/**
+ *  usbiss_open_serial
+ *    open USB-ISS with given USB serial number
+ */
+int usbiss_open_serial( t_usbiss *self, const char* serial, uint32_t baud )
+{
+    /** variable **/
+    char    charPort[128];  // UART port of adapter
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* find port */
+    if ( 0 != usbiss_find_uart(serial, charPort, sizeof(charPort)) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: no USB-ISS with serial '%s' found\n", __FUNCTION__, serial);
+        }
+        return -1;
+    }
+    return usbiss_open(self, charPort, baud);
+}
+
+
+
+/**
+ *  usbiss_set_cache
+ *    set handshake cache file
+ */
+int usbiss_set_cache( t_usbiss *self, const char* path )
+{
+    /* disable */
+    if ( NULL == path ) {
+        self->charCache[0] = '\0';
+        return 0;
+    }
+    if ( !(strlen(path) < sizeof(self->charCache)) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: cache path too long\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    strncpy(self->charCache, path, sizeof(self->charCache));
+    return 0;
+}
+
+
+
 /**
  *  usbiss_close
  *    close UART handle
@@ -1010,6 +1777,11 @@ int usbiss_close( t_usbiss *self )
 {
     /* Function Call Message */
     if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* write buffered registers and release register caches */
+    usbiss_regcache_disable(self, USBISS_REGCACHE_ALL);
+    /* stop watching */
+    usbiss_hotplug_enable(self, 0);
+    self->uint8Lost = 0;
     /* close UART handle */
     if ( self->uint8IsOpen ) {
         self->uint8IsOpen = 0;  // close handle
@@ -1033,14 +1805,22 @@ int usbiss_close( t_usbiss *self )
 
 
 /**
- *  usbiss_set_mode
- *    set USBISS transfer mode
+ *  @brief Transfer Mode
+ *
+ *  set up USB-ISS transfer mode by opcode, skips request if mode is already active
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      uint8Mode           USBISS transfer mode, #USBISS_MODE
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
  */
-int usbiss_set_mode( t_usbiss *self, const char* mode )
+static int usbiss_set_mode_raw( t_usbiss *self, uint8_t uint8Mode )
 {
     /** Variables **/
     char        charBuf[512];   // help buffer for string conversion
-    uint8_t     uint8Mode;      // new USBISS mode as opcode
     uint8_t     uint8Wr[16];    // write buffer
     uint8_t     uint8Rd[16];    // read buffer
     uint8_t     uint8WrLen;     // write packet length
@@ -1048,20 +1828,6 @@ int usbiss_set_mode( t_usbiss *self, const char* mode )
 
     /* Function Call Message */
     if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
-    /* USBISS open? */
-    if ( !self->uint8IsOpen ) {
-        if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: USBISS connection not open\n", __FUNCTION__);
-        }
-        return -1;
-    }
-    /* convert to int mode */
-    if ( 0 != usbiss_human_to_mode(mode, &uint8Mode) ) {
-        if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: USBISS mode '%s' unsupported\n", __FUNCTION__, mode);
-        }
-        return -1;
-    }
     /* mode change required? */
     if ( self->uint8Mode == uint8Mode ) {
         return 0;   // desired mode selected
@@ -1085,6 +1851,7 @@ int usbiss_set_mode( t_usbiss *self, const char* mode )
         printf("  INFO:%s:REQ: %s\n", __FUNCTION__, charBuf);
     }
     /* set USBISS */
+    ++(self->uint32ModeSwitch);
     if ( uint8WrLen != usbiss_uart_write(self, uint8Wr, (uint32_t) uint8WrLen) ) {  // request
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s: unexpected number of byte written\n", __FUNCTION__);
@@ -1098,6 +1865,9 @@ int usbiss_set_mode( t_usbiss *self, const char* mode )
         }
         return -1;
     }
+    if ( 0 != usbiss_rsp_stale(self, uint8Rd) ) {
+        return -1;  // response of other request, stream re-synced
+    }
     if ( USBISS_CMD_ACK != uint8Rd[0] ) {
         if ( 0 != self->uint8MsgLevel ) {
             printf("  ERROR:%s: Mode change rejected, reason 0x%02x\n", __FUNCTION__, uint8Rd[1]);
@@ -1113,14 +1883,72 @@ int usbiss_set_mode( t_usbiss *self, const char* mode )
 
 
 /**
- *  usbiss_i2c_scan
- *    scan for I2C devices
+ *  @brief I2C clock of slave
+ *
+ *  get transfer mode for slave access, registered clock profile or default mode
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @return         uint8_t             USBISS transfer mode, #USBISS_MODE
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
  */
-int usbiss_i2c_scan( t_usbiss *self, int8_t start, int8_t stop, int8_t* i2c, uint8_t len )
+static uint8_t usbiss_i2c_clk_of( t_usbiss *self, uint8_t adr7 )
+{
+    /* slave with profile */
+    if ( USBISS_IO_MODE != self->uint8I2cClk[adr7 & 0x7f] ) {
+        return self->uint8I2cClk[adr7 & 0x7f];
+    }
+    /* default mode from usbiss_set_mode */
+    if ( 0 == usbiss_is_i2c_mode(self->uint8ModeDflt) ) {
+        return self->uint8ModeDflt;
+    }
+    /* keep current mode */
+    return self->uint8Mode;
+}
+
+
+
+/**
+ *  @brief I2C clock select
+ *
+ *  switches USB-ISS to the transfer mode of the slave, only if required
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_i2c_clk_select( t_usbiss *self, uint8_t adr7 )
 {
     /** Variables **/
-    int         intNumI2c = 0;  // found i2c devices
-    int         intRet;         // help variable
+    uint8_t uint8Mode = usbiss_i2c_clk_of(self, adr7);
+
+    /* no switch needed */
+    if ( self->uint8Mode == uint8Mode ) {
+        return 0;
+    }
+    /* switch */
+    if ( 0 != self->uint8MsgLevel ) {
+        printf("  INFO:%s: adr=0x%02x, %s -> ", __FUNCTION__, adr7, usbiss_mode_to_human(self->uint8Mode));
+        printf("%s\n", usbiss_mode_to_human(uint8Mode));
+    }
+    return usbiss_set_mode_raw(self, uint8Mode);
+}
+
+
+
+/**
+ *  usbiss_set_mode
+ *    set USBISS transfer mode
+ */
+int usbiss_set_mode( t_usbiss *self, const char* mode )
+{
+    /** Variables **/
+    uint8_t     uint8Mode;      // new USBISS mode as opcode
 
     /* Function Call Message */
     if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
@@ -1131,186 +1959,2161 @@ int usbiss_i2c_scan( t_usbiss *self, int8_t start, int8_t stop, int8_t* i2c, uin
         }
         return -1;
     }
-    /* I2C mode setted? */
-    if ( 0 != usbiss_is_i2c_mode(self->uint8Mode) ) {
+    /* convert to int mode */
+    if ( 0 != usbiss_human_to_mode(mode, &uint8Mode) ) {
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: USBISS is configured for non I2C mode\n", __FUNCTION__);
+            printf("  ERROR:%s: USBISS mode '%s' unsupported\n", __FUNCTION__, mode);
         }
         return -1;
     }
-    /* iterate over device addresses */
-    for ( uint8_t i = ((uint8_t) (start & 0x7f)); i < ((uint8_t)(stop & 0x7f)) + 1; i++ ) {
-        /* check for enough memory */
-        if ( !(intNumI2c < len) ) {
-            if ( 0 != self->uint8MsgLevel ) {
-                printf("  ERROR:%s: not enough memory\n", __FUNCTION__);
-            }
-            return -1;
-        }
-        /* send start bit */
-        for ( uint8_t j = 0; j < USBISS_I2C_SCAN_RETRY; j++ ) { // retry three times if something went wrong
-            /* apply startbit */
-            intRet = usbiss_i2c_startbit(self, (uint8_t) ((i << 1) | USBISS_I2C_WR));
-            /* i2c device present */
+    /* set mode */
+    if ( 0 != usbiss_set_mode_raw(self, uint8Mode) ) {
+        return -1;
+    }
+    /* default for slaves without clock profile */
+    self->uint8ModeDflt = uint8Mode;
+    /* graceful end */
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_i2c_set_clk
+ *    register I2C clock profile for slave
+ */
+int usbiss_i2c_set_clk( t_usbiss *self, uint8_t adr7, const char* mode )
+{
+    /** Variables **/
+    uint8_t     uint8Mode;      // I2C mode as opcode
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* remove profile */
+    if ( (NULL == mode) || ('\0' == mode[0]) ) {
+        self->uint8I2cClk[adr7 & 0x7f] = USBISS_IO_MODE;
+        return 0;
+    }
+    /* convert to int mode, only I2C allowed */
+    if ( (0 != usbiss_human_to_mode(mode, &uint8Mode)) || (0 != usbiss_is_i2c_mode(uint8Mode)) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: I2C mode '%s' unsupported\n", __FUNCTION__, mode);
+        }
+        return -1;
+    }
+    self->uint8I2cClk[adr7 & 0x7f] = uint8Mode;
+    /* graceful end */
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_i2c_get_clk
+ *    transfer mode of slave access
+ */
+uint8_t usbiss_i2c_get_clk( t_usbiss *self, uint8_t adr7 )
+{
+    return usbiss_i2c_clk_of(self, adr7);
+}
+
+
+
+/**
+ *  @brief i2c-multiplexer find
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address of multiplexer
+ *  @return         int                 index in self->i2cMux, -1: not declared
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_i2c_mux_find( t_usbiss *self, uint8_t adr7 )
+{
+    for ( uint8_t i = 0; i < self->uint8MuxNum; i++ ) {
+        if ( adr7 == self->i2cMux[i].uint8Adr7 ) {
+            return (int) i;
+        }
+    }
+    return -1;
+}
+
+
+
+/**
+ *  @brief i2c-multiplexer control register
+ *
+ *  @param[in]      *mux                multiplexer
+ *  @param[in]      channel             channel or #USBISS_I2C_MUX_OFF
+ *  @return         uint8_t             control register value
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint8_t usbiss_i2c_mux_ctrl( const t_usbiss_i2c_mux *mux, uint8_t channel )
+{
+    if ( USBISS_I2C_MUX_OFF == channel ) {
+        return 0;
+    }
+    if ( 0 != mux->uint8Enc ) {
+        return (uint8_t) (0x04 | channel);  // enable bit + channel number
+    }
+    return (uint8_t) (1 << channel);
+}
+
+
+
+/**
+ *  @brief i2c-multiplexer touch
+ *
+ *  write to multiplexer address outside of #usbiss_i2c_mux_select, selected
+ *  channel is unknown afterwards
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      wrLen               number of written bytes
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_i2c_mux_touch( t_usbiss *self, uint8_t adr7, size_t wrLen )
+{
+    /** Variables **/
+    int     intMux; // multiplexer index
+
+    if ( 0 == wrLen ) {
+        return;
+    }
+    intMux = usbiss_i2c_mux_find(self, adr7);
+    if ( 0 <= intMux ) {
+        self->i2cMux[intMux].uint8Sel = USBISS_I2C_MUX_UNKNOWN;
+    }
+}
+
+
+
+/**
+ *  @brief i2c-multiplexer invalidate
+ *
+ *  forgets selected channel of all multiplexers
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_i2c_mux_invalidate( t_usbiss *self )
+{
+    for ( uint8_t i = 0; i < self->uint8MuxNum; i++ ) {
+        self->i2cMux[i].uint8Sel = USBISS_I2C_MUX_UNKNOWN;
+    }
+}
+
+
+
+/**
+ *  usbiss_i2c_recover
+ *    free clamped I2C bus and re-sync USB-ISS
+ */
+int usbiss_i2c_recover( t_usbiss *self )
+{
+    /** Variables **/
+    uint8_t     uint8Wr[2+2*USBISS_RECOVER_CLK];    // DIRECT + n * (NCK + READ)
+    uint8_t     uint8Rd[2+USBISS_RECOVER_CLK];      // status + read data
+    uint8_t     uint8Mode;                          // active transfer mode
+    uint32_t    uint32RdLen;                        // number of read bytes from UART
+    int         intRet = 0;                         // recovery result
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* USBISS open? */
+    if ( !self->uint8IsOpen ) {
+        return -1;
+    }
+    ++(self->uint32Recover);
+    /* interrupted select writes */
+    usbiss_i2c_mux_invalidate(self);
+    /* drop pending data */
+    usbiss_resync(self);
+    /* release bus */
+    usbiss_i2c_stopbit(self);
+    /* clock out stuck slave, every NACKed byte read generates nine SCL cycles */
+    uint8Wr[0] = USBISS_I2C_DIRECT;
+    for ( uint8_t i = 0; i < USBISS_RECOVER_CLK; i++ ) {
+        uint8Wr[1+2*i] = USBISS_I2C_NCK;
+        uint8Wr[2+2*i] = USBISS_I2C_READ;
+    }
+    if ( sizeof(uint8Wr) == usbiss_uart_write(self, uint8Wr, sizeof(uint8Wr)) ) {
+        uint32RdLen = usbiss_uart_read(self, uint8Rd, 2);
+        if ( (2 == uint32RdLen) && (USBISS_CMD_ACK == uint8Rd[0]) ) {
+            usbiss_uart_read(self, uint8Rd+2, usbiss_min((uint32_t) uint8Rd[1], (uint32_t) USBISS_RECOVER_CLK));
+        }
+    }
+    usbiss_uart_free(self);
+    /* release bus */
+    if ( 0 != usbiss_i2c_stopbit(self) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: Stopbit failed, BUS still clamped\n", __FUNCTION__);
+        }
+        intRet = -1;
+    }
+    /* re-apply transfer mode */
+    if ( 0 == usbiss_is_i2c_mode(self->uint8Mode) ) {
+        uint8Mode = self->uint8Mode;
+        self->uint8Mode = __UINT8_MAX__;    // force request
+        if ( 0 != usbiss_set_mode_raw(self, uint8Mode) ) {
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  ERROR:%s: re-apply mode %s\n", __FUNCTION__, usbiss_mode_to_human(uint8Mode));
+            }
+            self->uint8Mode = uint8Mode;
+            intRet = -1;
+        }
+    }
+    /* finish */
+    return intRet;
+}
+
+
+
+/**
+ *  @brief adapter lost
+ *
+ *  releases the dead UART handle, keeps transfer mode for restore
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_hotplug_lost( t_usbiss *self )
+{
+    /* already lost */
+    if ( 0 != self->uint8Lost ) {
+        return;
+    }
+    if ( 0 != self->uint8MsgLevel ) {
+        printf("  WARN:%s: USB-ISS %s at %s lost\n", __FUNCTION__, self->charUsbSerial, self->charPort);
+    }
+    /* restore mode after reconnect */
+    self->uint8ModeRestore = self->uint8Mode;
+    self->uint8ModeDfltRestore = self->uint8ModeDflt;
+    /* release handle */
+    if ( 0 != self->uint8IsOpen ) {
+        self->uint8IsOpen = 0;
+        simple_uart_close(self->uart);
+    }
+    self->uint8Lost = 1;
+    self->uint64HotplugTry = 0;     // reconnect immediately
+}
+
+
+
+/**
+ *  @brief adapter reconnect
+ *
+ *  opens re-enumerated adapter with same serial number and restores transfer mode
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_hotplug_reconnect( t_usbiss *self )
+{
+    /** Variables **/
+    char    charPort[sizeof(self->charPort)];   // UART port of adapter
+
+    /* rate limit */
+    if ( usbiss_time_us() < self->uint64HotplugTry ) {
+        return -1;
+    }
+    self->uint64HotplugTry = usbiss_time_us() + USBISS_HOTPLUG_RETRY_US;
+    /* adapter enumerated? */
+    if ( 0 != usbiss_find_uart(self->charUsbSerial, charPort, sizeof(charPort)) ) {
+        return -1;
+    }
+    /* open */
+    if ( 0 != usbiss_open(self, charPort, self->uint32BaudRate) ) {
+        return -1;  // port released by usbiss_open
+    }
+    /* restore mode */
+    if ( 0 == usbiss_is_i2c_mode(self->uint8ModeRestore) ) {
+        if ( 0 != usbiss_set_mode_raw(self, self->uint8ModeRestore) ) {
+            self->uint8IsOpen = 0;
+            simple_uart_close(self->uart);
+            return -1;
+        }
+    }
+    self->uint8ModeDflt = self->uint8ModeDfltRestore;
+    self->uint8Lost = 0;
+    ++(self->uint32Reconnect);
+    /* devices can be power cycled */
+    usbiss_regcache_invalidate(self, USBISS_REGCACHE_ALL, 0, 0);
+    usbiss_i2c_mux_invalidate(self);
+    if ( 0 != self->uint8MsgLevel ) {
+        printf("  INFO:%s: USB-ISS %s reconnected at %s\n", __FUNCTION__, self->charUsbSerial, self->charPort);
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief transfer failure
+ *
+ *  checks after a failed transfer if the adapter is still enumerated
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      intRet              transfer result
+ *  @return         int                 intRet or #USBISS_HOTPLUG_LOST
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_hotplug_check( t_usbiss *self, int intRet )
+{
+    /** Variables **/
+    char    charPort[sizeof(self->charPort)];   // UART port of adapter
+
+    /* only driver failures can be caused by lost adapter */
+    if ( (0 == self->uint8Hotplug) || !(0 > intRet) ) {
+        return intRet;
+    }
+    /* adapter still at same port */
+    if ( (0 == usbiss_find_uart(self->charUsbSerial, charPort, sizeof(charPort))) && (0 == strcmp(charPort, self->charPort)) ) {
+        return intRet;
+    }
+    usbiss_hotplug_lost(self);
+    return USBISS_HOTPLUG_LOST;
+}
+
+
+
+/**
+ *  usbiss_hotplug_enable
+ *    watch for re-enumeration of adapter
+ */
+int usbiss_hotplug_enable( t_usbiss *self, uint8_t enable )
+{
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* disable */
+    if ( 0 == enable ) {
+#if defined(__linux__)
+        if ( !(0 > self->intHotplugFd) ) {
+            close(self->intHotplugFd);
+        }
+#endif
+        self->intHotplugFd = -1;
+        self->uint8Hotplug = 0;
+        return 0;
+    }
+    /* serial number identifies adapter */
+    if ( !self->uint8IsOpen ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS not open\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    if ( 0 != usbiss_port_serial(self->charPort, self->charUsbSerial, sizeof(self->charUsbSerial)) ) {
+        strncpy(self->charUsbSerial, self->charSerial, sizeof(self->charUsbSerial));
+    }
+#if defined(__linux__)
+    /* device node events, without falls back to polling */
+    if ( 0 > self->intHotplugFd ) {
+        self->intHotplugFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if ( !(0 > self->intHotplugFd) ) {
+            if ( 0 > inotify_add_watch(self->intHotplugFd, "/dev", IN_CREATE | IN_DELETE | IN_ATTRIB) ) {
+                close(self->intHotplugFd);
+                self->intHotplugFd = -1;
+            }
+        }
+        if ( (0 > self->intHotplugFd) && (0 != self->uint8MsgLevel) ) {
+            printf("  WARN:%s: inotify unavailable, polling\n", __FUNCTION__);
+        }
+    }
+#endif
+    self->uint8Hotplug = 1;
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_hotplug_poll
+ *    process hotplug events and reconnect lost adapter
+ */
+int usbiss_hotplug_poll( t_usbiss *self )
+{
+#if defined(__linux__)
+    /** Variables **/
+    char                        charEvt[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+    const struct inotify_event* evt;        // inotify event
+    const char*                 charPtrTty; // tty name of adapter
+    ssize_t                     len;        // read event bytes
+#endif
+
+    /* disabled */
+    if ( 0 == self->uint8Hotplug ) {
+        return (0 != self->uint8IsOpen) ? 0 : -1;
+    }
+#if defined(__linux__)
+    /* removal of device node */
+    if ( !(0 > self->intHotplugFd) ) {
+        charPtrTty = strrchr(self->charPort, '/');
+        charPtrTty = (NULL == charPtrTty) ? self->charPort : charPtrTty + 1;
+        while ( 0 < (len = read(self->intHotplugFd, charEvt, sizeof(charEvt))) ) {
+            for ( char* ptr = charEvt; ptr < charEvt + len; ptr += sizeof(struct inotify_event) + evt->len ) {
+                evt = (const struct inotify_event*) ptr;
+                if ( (0 != (evt->mask & IN_DELETE)) && (0 != evt->len) && (0 == strcmp(evt->name, charPtrTty)) ) {
+                    usbiss_hotplug_lost(self);
+                }
+                if ( (0 != (evt->mask & (IN_CREATE | IN_ATTRIB))) && (0 == strncmp(evt->name, "ttyACM", 6)) ) {
+                    self->uint64HotplugTry = 0; // candidate, reconnect immediately
+                }
+            }
+        }
+    }
+#endif
+    /* reconnect */
+    if ( 0 != self->uint8Lost ) {
+        if ( 0 != usbiss_hotplug_reconnect(self) ) {
+            return USBISS_HOTPLUG_LOST;
+        }
+    }
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_i2c_scan
+ *    scan for I2C devices
+ */
+int usbiss_i2c_scan( t_usbiss *self, int8_t start, int8_t stop, int8_t* i2c, uint8_t len )
+{
+    /** Variables **/
+    int         intNumI2c = 0;  // found i2c devices
+    int         intRet;         // help variable
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* USBISS open? */
+    if ( !self->uint8IsOpen ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS connection not open\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* I2C mode setted? */
+    if ( 0 != usbiss_is_i2c_mode(self->uint8Mode) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS is configured for non I2C mode\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* iterate over device addresses */
+    for ( uint8_t i = ((uint8_t) (start & 0x7f)); i < ((uint8_t)(stop & 0x7f)) + 1; i++ ) {
+        /* check for enough memory */
+        if ( !(intNumI2c < len) ) {
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  ERROR:%s: not enough memory\n", __FUNCTION__);
+            }
+            return -1;
+        }
+        /* send start bit */
+        for ( uint8_t j = 0; j < USBISS_I2C_SCAN_RETRY; j++ ) { // retry three times if something went wrong
+            /* apply startbit */
+            intRet = usbiss_i2c_startbit(self, (uint8_t) ((i << 1) | USBISS_I2C_WR));
+            /* i2c device present */
             if ( 0 == intRet ) {
                 i2c[intNumI2c] = (int8_t) i;
                 ++intNumI2c;
                 break;
-            /* i2c device NOT present */
-            } else if ( USBISS_ERO_ID1 == intRet ) {
+            /* i2c device NOT present */
+            } else if ( USBISS_ERO_ID1 == intRet ) {
+                break;
+            }
+            /* user message */
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  WARN:%s: scan i2c adr %02x, retry...\n", __FUNCTION__, i);
+            }
+        }
+        /* Stop Bit */
+        intRet = usbiss_i2c_stopbit(self);
+        if ( 0 != intRet ) {
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  ERROR:%s: Stopbit failed, ero=0x%02x, BUS mayby clamped\n", __FUNCTION__, intRet);
+            }
+            return -1;
+        }
+    }
+    /* finish */
+    return intNumI2c;
+}
+
+
+
+/**
+ *  usbiss_i2c_test
+ *    checks for ACK of I2C device
+ */
+int usbiss_i2c_test( t_usbiss *self, uint8_t adr7, uint8_t num )
+{
+    /** Variables **/
+    uint8_t     uint8Wr[2 * USBISS_I2C_TEST_BURST];     // TEST + ADR per test
+    uint8_t     uint8Rd[USBISS_I2C_TEST_BURST];         // test results
+    uint32_t    uint32RdLen;                            // number of read bytes from UART
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* check args */
+    if ( (0 == num) || (USBISS_I2C_TEST_BURST < num) || (0x7f < adr7) ) {
+        return -1;
+    }
+    /* USBISS open? */
+    if ( !self->uint8IsOpen ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS connection not open\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* I2C clock of slave */
+    if ( 0 != usbiss_i2c_clk_select(self, adr7) ) {
+        return -1;
+    }
+    /* I2C mode setted? */
+    if ( 0 != usbiss_is_i2c_mode(self->uint8Mode) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS is configured for non I2C mode\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* tests in one request, saves USB round trips */
+    for ( uint8_t i = 0; i < num; i++ ) {
+        uint8Wr[2*i] = USBISS_I2C_TEST;
+        uint8Wr[2*i+1] = (uint8_t) ((adr7 << 1) | USBISS_I2C_WR);
+    }
+    if ( (uint32_t) (2*num) != usbiss_uart_write(self, uint8Wr, (uint32_t) (2*num)) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: request failed\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    uint32RdLen = usbiss_uart_read(self, uint8Rd, num);
+    if ( num != uint32RdLen ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: Unexpected number of %i bytes received\n", __FUNCTION__, uint32RdLen);
+        }
+        usbiss_resync(self);
+        return -1;
+    }
+    /* acknowledged */
+    for ( uint8_t i = 0; i < num; i++ ) {
+        if ( 0 != uint8Rd[i] ) {
+            return 0;
+        }
+    }
+    return USBISS_ERO_ID1;
+}
+
+
+
+/**
+ *  @brief I2C write
+ *
+ *  single write attempt to I2C device
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      iov                 write segments
+ *  @param[in]      iovNum              number of segments
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          July 7, 2023
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_i2c_wr_try( t_usbiss *self, uint8_t adr7, const t_usbiss_iovec *iov, size_t iovNum )
+{
+    /** Variables **/
+    int             intRet;         // internal return code, allows to send stop bit in case of crash
+    int             intRetStop;     // stop bit return code
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* empty frame provided */
+    if ( 0 == usbiss_iov_len(iov, iovNum) ) {
+        return 0;
+    }
+    /* USBISS open? */
+    if ( !self->uint8IsOpen ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS connection not open\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* I2C clock of slave */
+    if ( 0 != usbiss_i2c_clk_select(self, adr7) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: select I2C clock for adr=0x%02x\n", __FUNCTION__, adr7);
+        }
+        return -1;
+    }
+    /* I2C mode setted? */
+    if ( 0 != usbiss_is_i2c_mode(self->uint8Mode) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS is configured for non I2C mode\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* Startbit + ADR */
+    intRet = usbiss_i2c_startbit(self, (uint8_t) ((adr7 << 1) | USBISS_I2C_WR));
+    if ( 0 != intRet ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: Startbit failed\n", __FUNCTION__);
+        }
+        return intRet;
+    }
+    /* Intermideate Packets, DATA */
+    intRet = usbiss_i2c_data_wr(self, iov, iovNum);
+    if ( 0 != intRet ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s:PKG: Packet Transfer ero=0x%x, go on with STOP BIT to free the bus\n", __FUNCTION__, intRet);
+        }
+    }
+    /* Stop Bit */
+    intRetStop = usbiss_i2c_stopbit(self);
+    if ( 0 != intRetStop ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: Stopbit failed, BUS mayby clamped\n", __FUNCTION__);
+        }
+        return intRetStop;
+    }
+    /* graceful end, data transfer result */
+    return intRet;
+}
+
+
+
+/**
+ *  @brief I2C read
+ *
+ *  single read attempt from I2C device
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[out]     data                read data
+ *  @param[in]      len                 number of requested bytes
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          July 11, 2023
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_i2c_rd_try( t_usbiss *self, uint8_t adr7, void* data, size_t len )
+{
+    /** Variables **/
+    int             intRet;         // internal return code, allows to send stop bit in case of crash
+    int             intRetStop;     // stop bit return code
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* empty frame provided */
+    if ( 0 == len ) {
+        return 0;
+    }
+    /* USBISS open? */
+    if ( !self->uint8IsOpen ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS connection not open\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* I2C clock of slave */
+    if ( 0 != usbiss_i2c_clk_select(self, adr7) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: select I2C clock for adr=0x%02x\n", __FUNCTION__, adr7);
+        }
+        return -1;
+    }
+    /* I2C mode setted? */
+    if ( 0 != usbiss_is_i2c_mode(self->uint8Mode) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS is configured for non I2C mode\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* Startbit + ADR */
+    intRet = usbiss_i2c_startbit(self, (uint8_t) ((adr7 << 1) | USBISS_I2C_RD));
+    if ( 0 != intRet ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: Startbit failed\n", __FUNCTION__);
+        }
+        return intRet;
+    }
+    /* Intermideate Packets, read DATA */
+    intRet = usbiss_i2c_data_rd(self, data, len);
+    if ( 0 != intRet ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s:PKG: Packet Transfer ero=0x%x, go on with STOP BIT to free the bus\n", __FUNCTION__, intRet);
+        }
+    }
+    /* Stop Bit */
+    intRetStop = usbiss_i2c_stopbit(self);
+    if ( 0 != intRetStop ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: Stopbit failed, BUS mayby clamped\n", __FUNCTION__);
+        }
+        return intRetStop;
+    }
+    /* graceful end, data transfer result */
+    return intRet;
+}
+
+
+
+/**
+ *  @brief I2C write-read
+ *
+ *  single attempt, writes to i2c devices, sents repeated start for direction change and reads
+ *  from i2c device into a dedicated read buffer, wr and rd are allowed to overlap
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      iov                 write segments
+ *  @param[in]      iovNum              number of segments
+ *  @param[out]     rd                  read data
+ *  @param[in]      rdLen               number of requested bytes from slave
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_i2c_wr_rd_try( t_usbiss *self, uint8_t adr7, const t_usbiss_iovec *iov, size_t iovNum, void* rd, size_t rdLen )
+{
+    /** Variables **/
+    int     intRet = 0;     // internal return code, allows to send stop bit in case of crash
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* empty frame provided */
+    if ( (0 == usbiss_iov_len(iov, iovNum)) || (0 == rdLen) ) {
+        return 0;
+    }
+    /* USBISS open? */
+    if ( !self->uint8IsOpen ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS connection not open\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* I2C clock of slave */
+    if ( 0 != usbiss_i2c_clk_select(self, adr7) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: select I2C clock for adr=0x%02x\n", __FUNCTION__, adr7);
+        }
+        return -1;
+    }
+    /* I2C mode setted? */
+    if ( 0 != usbiss_is_i2c_mode(self->uint8Mode) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS is configured for non I2C mode\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* Startbit + ADR */
+    intRet |= usbiss_i2c_startbit(self, (uint8_t) ((adr7 << 1) | USBISS_I2C_WR));
+    if ( 0 != intRet ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: Startbit failed\n", __FUNCTION__);
+        }
+        return intRet;
+    }
+    /* Write data */
+    intRet |= usbiss_i2c_data_wr(self, iov, iovNum);
+    if ( 0 != intRet ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s:PKG: Packet Transfer ero=0x%x, go on with STOP BIT to free the bus\n", __FUNCTION__, intRet);
+        }
+    }
+    /* Repeated start + ADR, changes direction to read */
+    intRet |= usbiss_i2c_restartbit(self, (uint8_t) ((adr7 << 1) | USBISS_I2C_RD));
+    if ( 0 != intRet ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: Startbit failed\n", __FUNCTION__);
+        }
+    }
+    /* Read DATA */
+    intRet |= usbiss_i2c_data_rd(self, rd, rdLen);
+    if ( 0 != intRet ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s:PKG: Packet Transfer ero=0x%x, go on with STOP BIT to free the bus\n", __FUNCTION__, intRet);
+        }
+    }
+    /* Stop Bit */
+    intRet |= usbiss_i2c_stopbit(self);
+    if ( 0 != intRet ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: Stopbit failed, BUS mayby clamped\n", __FUNCTION__);
+        }
+    }
+    /* graceful end */
+    return intRet;
+}
+
+
+
+/**
+ *  @brief I2C retry
+ *
+ *  performs I2C transfer according retry policy #t_usbiss_retry
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      iov                 write segments
+ *  @param[in]      iovNum              number of segments
+ *  @param[out]     rd                  read data, allowed to overlap with write segments
+ *  @param[in]      rdLen               number of requested bytes from slave
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_i2c_retry( t_usbiss *self, uint8_t adr7, const t_usbiss_iovec *iov, size_t iovNum, void* rd, size_t rdLen )
+{
+    /** Variables **/
+    uint8_t         uint8WrSave[USBISS_I2C_CHUNK];  // write data, protects against overwrite by read data
+    uint8_t*        uint8PtrWrHeap = NULL;          // saved long write data overlapping read data
+    t_usbiss_iovec  save = {uint8WrSave, 0};        // saved write data as segment
+    const t_usbiss_iovec*   iovWr = iov;            // write segments of current attempt
+    size_t          iovWrNum = iovNum;              // number of write segments of current attempt
+    size_t          wrLen = usbiss_iov_len(iov, iovNum);    // number of bytes to write
+    size_t          rdOfs = 0;                      // already received read bytes, chunk resume
+    uint32_t    uint32Backoff;                  // current backoff time
+    uint32_t    uint32BackoffMul;               // backoff multiplier, at least one
+    uint64_t    uint64Adr;                      // register address for chunk resume
+    uint8_t     uint8Resume;                    // chunk resume possible
+    int         intRet = -1;                    // transfer result
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* direct multiplexer access */
+    usbiss_i2c_mux_touch(self, adr7, wrLen);
+    /* adapter re-enumerated */
+    if ( 0 != self->uint8Hotplug ) {
+        intRet = usbiss_hotplug_poll(self);
+        if ( 0 != intRet ) {
+            return intRet;
+        }
+    }
+    /* single attempt, no need for write protection */
+    if ( !(self->retry.uint8Attempts > 1) ) {
+        if ( (0 != wrLen) && (0 != rdLen) ) {
+            intRet = usbiss_i2c_wr_rd_try(self, adr7, iov, iovNum, rd, rdLen);
+        } else if ( 0 != rdLen ) {
+            intRet = usbiss_i2c_rd_try(self, adr7, rd, rdLen);
+        } else {
+            intRet = usbiss_i2c_wr_try(self, adr7, iov, iovNum);
+        }
+        return usbiss_hotplug_check(self, intRet);
+    }
+    /* write-read: keep write data, read data can overwrite it; chunk resume interprets write data as big endian register address */
+    uint8Resume = 0;
+    if ( (0 != wrLen) && (0 != rdLen) ) {
+        if ( !(wrLen > sizeof(uint8WrSave)) ) {
+            usbiss_iov_copy(uint8WrSave, iov, iovNum, 0, wrLen);
+            save.len = wrLen;
+            iovWr = &save;
+            iovWrNum = 1;
+            uint8Resume = (uint8_t) ((USBISS_RETRY_CHUNK == self->retry.uint8Resume) && !(wrLen > sizeof(uint64Adr)));
+        } else {
+            for ( size_t j = 0; (j < iovNum) && (NULL == uint8PtrWrHeap); j++ ) {
+                if ( ((uint8_t*) rd < (const uint8_t*) iov[j].base + iov[j].len) && ((const uint8_t*) iov[j].base < (uint8_t*) rd + rdLen) ) {
+                    uint8PtrWrHeap = malloc(wrLen);
+                    if ( NULL == uint8PtrWrHeap ) {
+                        if ( 0 != self->uint8MsgLevel ) {
+                            printf("  ERROR:%s: memory allocation\n", __FUNCTION__);
+                        }
+                        return -1;
+                    }
+                    usbiss_iov_copy(uint8PtrWrHeap, iov, iovNum, 0, wrLen);
+                    save.base = uint8PtrWrHeap;
+                    save.len = wrLen;
+                    iovWr = &save;
+                    iovWrNum = 1;
+                }
+            }
+        }
+    }
+    /* attempts */
+    uint32Backoff = self->retry.uint32BackoffUs;
+    for ( uint8_t i = 0; i < self->retry.uint8Attempts; i++ ) {
+        /* backoff and bus recovery before retry */
+        if ( 0 != i ) {
+            ++(self->uint32Retry);
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  WARN:%s: adr=0x%02x, ero=0x%x, retry %i of %i in %uus\n", __FUNCTION__, adr7, intRet, i, self->retry.uint8Attempts-1, uint32Backoff);
+            }
+            if ( 0 != self->retry.uint8Recover ) {
+                usbiss_i2c_recover(self);
+            } else {
+                usbiss_resync(self);
+            }
+            usbiss_sleep_us(uint32Backoff);
+            uint32BackoffMul = usbiss_max((uint32_t) self->retry.uint8BackoffMul, (uint32_t) 1);
+            uint32Backoff = (uint32Backoff > self->retry.uint32BackoffMaxUs / uint32BackoffMul) ? self->retry.uint32BackoffMaxUs : (uint32Backoff * uint32BackoffMul);  // no overflow
+        }
+        /* attempt */
+        self->sizeRdDone = 0;
+        if ( (0 != wrLen) && (0 != rdLen) ) {
+            intRet = usbiss_i2c_wr_rd_try(self, adr7, iovWr, iovWrNum, (uint8_t*) rd + rdOfs, rdLen - rdOfs);
+        } else if ( 0 != rdLen ) {
+            intRet = usbiss_i2c_rd_try(self, adr7, rd, rdLen);
+        } else {
+            intRet = usbiss_i2c_wr_try(self, adr7, iov, iovNum);
+        }
+        if ( 0 == intRet ) {
+            break;
+        }
+        intRet = usbiss_hotplug_check(self, intRet);
+        /* not retryable, or connection lost; combined or unknown codes are not retryable */
+        if ( (!self->uint8IsOpen) || !(intRet < USBISS_RETRY_ERO_NUM) || (0 == (self->retry.uint16Retryable & USBISS_RETRY_ERO((0 > intRet) ? 0 : intRet))) ) {
+            break;
+        }
+        /* resume with next unread register */
+        if ( (0 != uint8Resume) && (0 != self->sizeRdDone) ) {
+            uint64Adr = 0;
+            for ( size_t j = 0; j < wrLen; j++ ) {
+                uint64Adr = (uint64Adr << 8) | uint8WrSave[j];
+            }
+            uint64Adr += self->sizeRdDone;
+            for ( size_t j = wrLen; j > 0; j-- ) {
+                uint8WrSave[j-1] = (uint8_t) (uint64Adr & 0xff);
+                uint64Adr >>= 8;
+            }
+            rdOfs += self->sizeRdDone;
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  INFO:%s: resume at read offset 0x%zx\n", __FUNCTION__, rdOfs);
+            }
+        }
+    }
+    /* done or retries exhausted */
+    free(uint8PtrWrHeap);
+    return intRet;
+}
+
+
+
+/**
+ *  @brief direct frame
+ *
+ *  sends assembled direct frame in I2C clock of slave and receives read
+ *  data. A NACK aborts the whole frame.
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address, selects I2C clock
+ *  @param[in]      *wr                 direct frame
+ *  @param[in]      wrLen               number of bytes in wr
+ *  @param[out]     *rd                 status + number of read bytes + read data
+ *  @param[in]      rdLen               number of expected read bytes
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_i2c_frame_run( t_usbiss *self, uint8_t adr7, uint8_t *wr, size_t wrLen, uint8_t *rd, size_t rdLen )
+{
+    /** Variables **/
+    uint32_t    uint32RdLen;    // number of read bytes from UART
+
+    if ( (0 == self->uint8IsOpen) || (0 != self->uint8Lost) || (0 != usbiss_i2c_clk_select(self, adr7)) || (0 != usbiss_is_i2c_mode(self->uint8Mode)) ) {
+        return -1;
+    }
+    if ( wrLen != usbiss_uart_write(self, wr, (uint32_t) wrLen) ) {
+        return -1;
+    }
+    uint32RdLen = usbiss_uart_read(self, rd, 2);
+    if ( (2 != uint32RdLen) || (0 != usbiss_rsp_stale(self, rd)) ) {
+        return -1;
+    }
+    if ( USBISS_CMD_ACK != rd[0] ) {
+        return (int) (rd[1]);   // USBISS error code, #USBISS_ERROR
+    }
+    if ( (rdLen != rd[1]) || ((0 != rdLen) && (rdLen != usbiss_uart_read(self, rd+2, (uint32_t) rdLen))) ) {
+        usbiss_resync(self);
+        return -1;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief register cache burst
+ *
+ *  writes register address and burst data in one direct frame, split into
+ *  #USBISS_I2C_CHUNK byte writes. A rejected frame is finished with a stop
+ *  bit, if the retry policy allows further attempts for the error the burst
+ *  is repeated by #usbiss_i2c_retry, rewriting registers with the same
+ *  values is harmless.
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      iov                 register address and burst data, 2 segments
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_regcache_burst( t_usbiss *self, uint8_t adr7, const t_usbiss_iovec *iov )
+{
+    /** Variables **/
+    uint8_t     uint8Wr[USBISS_I2C_FRAME];  // direct frame
+    uint8_t     uint8Rd[2];                 // status + number of read bytes
+    size_t      len;                        // bytes of register address and data
+    size_t      chunk;                      // bytes of write command
+    size_t      wrLen = 0;                  // bytes in direct frame
+    int         intRet;                     // frame result
+
+    /* assemble START + WRITE + ADR + n * (WRITE + DATA) + STOP */
+    len = usbiss_iov_len(iov, 2);
+    uint8Wr[wrLen++] = USBISS_I2C_DIRECT;
+    uint8Wr[wrLen++] = USBISS_I2C_START;
+    uint8Wr[wrLen++] = USBISS_I2C_WRITE;
+    uint8Wr[wrLen++] = (uint8_t) ((adr7 << 1) | USBISS_I2C_WR);
+    for ( size_t i = 0; i < len; i += chunk ) {
+        chunk = usbiss_min(len - i, (size_t) USBISS_I2C_CHUNK);
+        uint8Wr[wrLen++] = (uint8_t) (USBISS_I2C_WRITE + chunk - 1);
+        usbiss_iov_copy(uint8Wr+wrLen, iov, 2, i, chunk);     // gathered from cache, no staging copy
+        wrLen += chunk;
+    }
+    uint8Wr[wrLen++] = USBISS_I2C_STOP;
+    /* one round trip, retry policy on failure */
+    usbiss_i2c_mux_touch(self, adr7, len);
+    intRet = usbiss_i2c_frame_run(self, adr7, uint8Wr, wrLen, uint8Rd, 0);
+    if ( 0 == intRet ) {
+        return 0;
+    }
+    if ( (0 != self->uint8IsOpen) && (0 == self->uint8Lost) ) {
+        usbiss_i2c_stopbit(self);
+    }
+    /* frame was the first attempt */
+    if ( !(self->retry.uint8Attempts > 1) || !(intRet < USBISS_RETRY_ERO_NUM) || (0 == (self->retry.uint16Retryable & USBISS_RETRY_ERO((0 > intRet) ? 0 : intRet))) ) {
+        return intRet;
+    }
+    return usbiss_i2c_retry(self, adr7, iov, 2, NULL, 0);
+}
+
+
+
+/**
+ *  @brief register cache flush device
+ *
+ *  writes buffered registers of I2C slave. Adjacent buffered registers are
+ *  merged into one auto-increment burst of up to #USBISS_REGCACHE_BURST bytes,
+ *  gaps of up to uint8Gap cached registers are bridged with the cached
+ *  values, see #usbiss_regcache_gap. Every burst is one direct frame, see #usbiss_regcache_burst.
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_regcache_flush_dev( t_usbiss *self, uint8_t adr7 )
+{
+    /** Variables **/
+    t_usbiss_regcache*  cache = self->regcache[adr7];   // register cache of slave
+    uint8_t     uint8Adr[2];    // register address
+    t_usbiss_iovec  iov[2] = {{uint8Adr, 0}, {NULL, 0}};    // register address and burst data
+    uint32_t    start;          // first register of burst
+    uint32_t    end;            // behind last buffered register of burst
+    uint32_t    reg;            // register iterator
+    uint8_t*    uint8PtrFlag;   // register flags
+    int         intRet;         // burst result
+    int         intEro = 0;     // first failed burst
+
+    /* nothing buffered */
+    if ( (NULL == cache) || (0 == cache->uint64Dirty) ) {
+        return 0;
+    }
+    uint8PtrFlag = cache->uint8PtrFlag;
+    reg = cache->uint32DirtyLo;
+    while ( reg <= cache->uint32DirtyHi ) {
+        if ( 0 == (uint8PtrFlag[reg] & USBISS_REG_DIRTY) ) {
+            ++reg;
+            continue;
+        }
+        /* extend burst over buffered registers and enabled gaps of cached ones */
+        start = reg;
+        end = reg + 1;
+        for ( reg = end; (reg <= cache->uint32DirtyHi) && (reg - start < USBISS_REGCACHE_BURST); reg++ ) {
+            if ( 0 != (uint8PtrFlag[reg] & USBISS_REG_DIRTY) ) {
+                end = reg + 1;
+            } else if ( (0 == (uint8PtrFlag[reg] & USBISS_REG_VLD)) || (USBISS_REG_VOLATILE == (uint8PtrFlag[reg] & USBISS_REG_ATTR)) || (reg - end >= cache->uint8Gap) ) {
+                break;
+            }
+        }
+        /* burst */
+        for ( uint8_t i = 0; i < cache->uint8AdrBytes; i++ ) {
+            uint8Adr[i] = (uint8_t) (start >> (8 * (cache->uint8AdrBytes - 1 - i)));
+        }
+        iov[0].len = cache->uint8AdrBytes;
+        iov[1].base = cache->uint8PtrVal + start;
+        iov[1].len = (size_t) (end - start);
+        intRet = usbiss_regcache_burst(self, adr7, iov);
+        ++(self->uint32CacheBurst);
+        for ( reg = start; reg < end; reg++ ) {
+            uint8PtrFlag[reg] = (uint8_t) ((0 == intRet) ? (uint8PtrFlag[reg] & ~USBISS_REG_DIRTY) : (uint8PtrFlag[reg] & USBISS_REG_ATTR));
+        }
+        if ( 0 != intRet ) {
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  ERROR:%s: adr=0x%02x, reg=0x%x..0x%x, ero=0x%x\n", __FUNCTION__, adr7, start, end - 1, intRet);
+            }
+            intEro = (0 == intEro) ? intRet : intEro;
+        }
+        reg = end;
+    }
+    cache->uint64Dirty = 0;
+    return intEro;
+}
+
+
+
+/**
+ *  @brief register cache deadline
+ *
+ *  flushes I2C slaves with expired write-back deadline and updates the
+ *  earliest pending deadline. The first failed flush is latched for
+ *  #usbiss_regcache_poll and #usbiss_regcache_flush.
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      now                 current time in us, 0: flush none
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_regcache_deadline( t_usbiss *self, uint64_t now )
+{
+    /** Variables **/
+    t_usbiss_regcache*  cache;  // register cache of slave
+    uint64_t            due;    // deadline of slave
+    int                 intRet; // flush result
+
+    self->uint64CacheFlush = 0;
+    for ( uint8_t i = 0; i < USBISS_I2C_NUM_ADR; i++ ) {
+        cache = self->regcache[i];
+        if ( (NULL == cache) || (0 == cache->uint64Dirty) || (0 == cache->uint32DeadlineUs) ) {
+            continue;
+        }
+        due = cache->uint64Dirty + cache->uint32DeadlineUs;
+        if ( (0 != now) && (now >= due) ) {
+            intRet = usbiss_regcache_flush_dev(self, i);    // failed registers are invalidated
+            self->intCacheEro = (0 == self->intCacheEro) ? intRet : self->intCacheEro;
+            continue;
+        }
+        self->uint64CacheFlush = ((0 == self->uint64CacheFlush) || (due < self->uint64CacheFlush)) ? due : self->uint64CacheFlush;
+    }
+}
+
+
+
+/**
+ *  @brief register cache transfer
+ *
+ *  serves register read from cache, buffers register write in write-back
+ *  mode or performs I2C transfer and updates register cache. Transfers
+ *  which are no register read or write are passed. Buffered writes are
+ *  flushed before every transferred access of the I2C slave.
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      iov                 write segments, register address followed by register values
+ *  @param[in]      iovNum              number of segments
+ *  @param[out]     rd                  read data, allowed to overlap with write segments
+ *  @param[in]      rdLen               number of requested bytes from slave
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_regcache_xfer( t_usbiss *self, uint8_t adr7, const t_usbiss_iovec *iov, size_t iovNum, void* rd, size_t rdLen )
+{
+    /** Variables **/
+    t_usbiss_regcache*  cache;      // register cache of slave
+    size_t              wrLen;      // number of bytes to write
+    uint8_t             uint8Adr[2];    // register address
+    uint32_t            reg = 0;    // first register
+    size_t              num;        // number of registers
+    uint8_t*            uint8PtrFlag;   // flags of first register
+    int                 intRet;     // transfer result
+
+    /* write-back deadline expired */
+    if ( (0 != self->uint64CacheFlush) && (usbiss_time_us() >= self->uint64CacheFlush) ) {
+        usbiss_regcache_deadline(self, usbiss_time_us());
+    }
+    /* register access of cached slave? */
+    cache = (adr7 < USBISS_I2C_NUM_ADR) ? self->regcache[adr7] : NULL;
+    if ( NULL == cache ) {
+        return usbiss_i2c_retry(self, adr7, iov, iovNum, rd, rdLen);
+    }
+    wrLen = usbiss_iov_len(iov, iovNum);
+    if ( (wrLen < cache->uint8AdrBytes) || ((0 != rdLen) && (wrLen != cache->uint8AdrBytes)) || ((0 == rdLen) && (wrLen == cache->uint8AdrBytes)) ) {
+        intRet = usbiss_regcache_flush_dev(self, adr7);
+        return (0 != intRet) ? intRet : usbiss_i2c_retry(self, adr7, iov, iovNum, rd, rdLen);
+    }
+    usbiss_iov_copy(uint8Adr, iov, iovNum, 0, cache->uint8AdrBytes);
+    for ( uint8_t i = 0; i < cache->uint8AdrBytes; i++ ) {
+        reg = (reg << 8) | uint8Adr[i];
+    }
+    num = (0 != rdLen) ? rdLen : (wrLen - cache->uint8AdrBytes);
+    if ( (reg >= cache->uint32Num) || ((0 != rdLen) && (num > cache->uint32Num - reg)) ) {
+        intRet = usbiss_regcache_flush_dev(self, adr7);
+        return (0 != intRet) ? intRet : usbiss_i2c_retry(self, adr7, iov, iovNum, rd, rdLen);
+    }
+    uint8PtrFlag = cache->uint8PtrFlag + reg;
+    /* register read */
+    if ( 0 != rdLen ) {
+        for ( size_t i = 0; i < num; i++ ) {
+            if ( 0 == (uint8PtrFlag[i] & USBISS_REG_VLD) ) {
+                break;
+            }
+            if ( i == num - 1 ) {
+                memcpy(rd, cache->uint8PtrVal + reg, num);
+                ++(self->uint32CacheHit);
+                return 0;
+            }
+        }
+        ++(self->uint32CacheMiss);
+        intRet = usbiss_regcache_flush_dev(self, adr7);
+        if ( 0 != intRet ) {
+            return intRet;
+        }
+        intRet = usbiss_i2c_retry(self, adr7, iov, iovNum, rd, rdLen);
+        if ( 0 == intRet ) {
+            for ( size_t i = 0; i < num; i++ ) {
+                if ( USBISS_REG_CACHE == (uint8PtrFlag[i] & USBISS_REG_ATTR) ) {
+                    cache->uint8PtrVal[reg + i] = ((uint8_t*) rd)[i];
+                    uint8PtrFlag[i] |= USBISS_REG_VLD;
+                }
+            }
+        }
+        return intRet;
+    }
+    /* write-back, buffer write of cached registers */
+    if ( (0 != cache->uint8WrBack) && (num <= cache->uint32Num - reg) ) {
+        for ( size_t i = 0; i < num; i++ ) {
+            if ( USBISS_REG_VOLATILE == (uint8PtrFlag[i] & USBISS_REG_ATTR) ) {
+                break;
+            }
+            if ( i == num - 1 ) {
+                usbiss_iov_copy(cache->uint8PtrVal + reg, iov, iovNum, cache->uint8AdrBytes, num);
+                for ( size_t j = 0; j < num; j++ ) {
+                    uint8PtrFlag[j] |= USBISS_REG_VLD | USBISS_REG_DIRTY;
+                }
+                if ( 0 == cache->uint64Dirty ) {
+                    cache->uint64Dirty = usbiss_time_us();
+                    cache->uint32DirtyLo = reg;
+                    cache->uint32DirtyHi = reg + (uint32_t) num - 1;
+                    usbiss_regcache_deadline(self, 0);
+                }
+                cache->uint32DirtyLo = usbiss_min(cache->uint32DirtyLo, reg);
+                cache->uint32DirtyHi = usbiss_max(cache->uint32DirtyHi, reg + (uint32_t) num - 1);
+                ++(self->uint32CacheWrBuf);
+                return 0;
+            }
+        }
+    }
+    /* register write, failed write leaves register content unknown */
+    intRet = usbiss_regcache_flush_dev(self, adr7);
+    if ( 0 != intRet ) {
+        return intRet;
+    }
+    intRet = usbiss_i2c_retry(self, adr7, iov, iovNum, rd, rdLen);
+    num = usbiss_min(num, (size_t) (cache->uint32Num - reg));
+    if ( 0 == intRet ) {
+        usbiss_iov_copy(cache->uint8PtrVal + reg, iov, iovNum, cache->uint8AdrBytes, num);  // volatile registers stay invalid
+    }
+    for ( size_t i = 0; i < num; i++ ) {
+        if ( (0 == intRet) && (USBISS_REG_VOLATILE != (uint8PtrFlag[i] & USBISS_REG_ATTR)) ) {
+            uint8PtrFlag[i] |= USBISS_REG_VLD;
+        } else {
+            uint8PtrFlag[i] &= USBISS_REG_ATTR;
+        }
+    }
+    return intRet;
+}
+
+
+
+/**
+ *  usbiss_regcache_enable
+ *    allocates register cache of I2C slave
+ */
+int usbiss_regcache_enable( t_usbiss *self, uint8_t adr7, uint8_t adrBytes, uint32_t num )
+{
+    /** Variables **/
+    t_usbiss_regcache*  cache;  // register cache
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* check */
+    if ( (adr7 >= USBISS_I2C_NUM_ADR) || (1 > adrBytes) || (2 < adrBytes) || (0 == num) || (num > ((uint32_t) 1 << (8 * adrBytes))) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: adr=0x%02x, adrBytes=%u, num=%u unsupported\n", __FUNCTION__, adr7, adrBytes, num);
+        }
+        return -1;
+    }
+    /* flags and values behind handle */
+    usbiss_regcache_disable(self, adr7);
+    cache = calloc(1, sizeof(t_usbiss_regcache) + 2 * (size_t) num);
+    if ( NULL == cache ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: memory allocation\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    cache->uint8AdrBytes = adrBytes;
+    cache->uint32Num = num;
+    cache->uint8PtrFlag = (uint8_t*) (cache + 1);
+    cache->uint8PtrVal = cache->uint8PtrFlag + num;
+    self->regcache[adr7] = cache;
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_regcache_disable
+ *    flushes and releases register cache of I2C slave
+ */
+void usbiss_regcache_disable( t_usbiss *self, uint8_t adr7 )
+{
+    for ( uint8_t i = 0; i < USBISS_I2C_NUM_ADR; i++ ) {
+        if ( ((USBISS_REGCACHE_ALL == adr7) || (i == adr7)) && (NULL != self->regcache[i]) ) {
+            if ( 0 != self->uint8IsOpen ) {
+                usbiss_regcache_flush_dev(self, i);
+            }
+            free(self->regcache[i]);
+            self->regcache[i] = NULL;
+        }
+    }
+    usbiss_regcache_deadline(self, 0);
+}
+
+
+
+/**
+ *  usbiss_regcache_attr
+ *    sets attribute of register range
+ */
+int usbiss_regcache_attr( t_usbiss *self, uint8_t adr7, uint32_t reg, uint32_t num, uint8_t attr )
+{
+    /** Variables **/
+    t_usbiss_regcache*  cache;  // register cache
+
+    /* check */
+    cache = (adr7 < USBISS_I2C_NUM_ADR) ? self->regcache[adr7] : NULL;
+    if ( (NULL == cache) || (reg >= cache->uint32Num) || (num > cache->uint32Num - reg) || (USBISS_REG_WRITE < attr) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: adr=0x%02x, reg=0x%x, num=%u, attr=%u unsupported\n", __FUNCTION__, adr7, reg, num, attr);
+        }
+        return -1;
+    }
+    /* buffered writes go out with old attribute */
+    if ( 0 != usbiss_regcache_flush_dev(self, adr7) ) {
+        return -1;
+    }
+    memset(cache->uint8PtrFlag + reg, attr, num);   // invalidates
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_regcache_invalidate
+ *    marks cached register values as unknown
+ */
+int usbiss_regcache_invalidate( t_usbiss *self, uint8_t adr7, uint32_t reg, uint32_t num )
+{
+    /** Variables **/
+    t_usbiss_regcache*  cache;  // register cache
+
+    /* all devices */
+    if ( USBISS_REGCACHE_ALL == adr7 ) {
+        for ( uint8_t i = 0; i < USBISS_I2C_NUM_ADR; i++ ) {
+            if ( NULL != self->regcache[i] ) {
+                usbiss_regcache_invalidate(self, i, 0, 0);
+            }
+        }
+        return 0;
+    }
+    /* check */
+    cache = (adr7 < USBISS_I2C_NUM_ADR) ? self->regcache[adr7] : NULL;
+    if ( (NULL == cache) || (reg >= cache->uint32Num) || (num > cache->uint32Num - reg) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: adr=0x%02x, reg=0x%x, num=%u unsupported\n", __FUNCTION__, adr7, reg, num);
+        }
+        return -1;
+    }
+    /* buffered registers stay valid until flushed */
+    num = (0 == num) ? (cache->uint32Num - reg) : num;
+    for ( uint32_t i = reg; i < reg + num; i++ ) {
+        if ( 0 == (cache->uint8PtrFlag[i] & USBISS_REG_DIRTY) ) {
+            cache->uint8PtrFlag[i] &= USBISS_REG_ATTR;
+        }
+    }
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_regcache_wrback
+ *    enables buffering of register writes
+ */
+int usbiss_regcache_wrback( t_usbiss *self, uint8_t adr7, uint8_t enable, uint32_t deadlineUs )
+{
+    /** Variables **/
+    t_usbiss_regcache*  cache;  // register cache
+    int                 intRet; // flush result
+
+    /* check */
+    cache = (adr7 < USBISS_I2C_NUM_ADR) ? self->regcache[adr7] : NULL;
+    if ( NULL == cache ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: adr=0x%02x without register cache\n", __FUNCTION__, adr7);
+        }
+        return -1;
+    }
+    /* leaving write-back writes buffered registers */
+    intRet = (0 == enable) ? usbiss_regcache_flush_dev(self, adr7) : 0;
+    cache->uint8WrBack = (uint8_t) ((0 != enable) ? 1 : 0);
+    cache->uint32DeadlineUs = deadlineUs;
+    usbiss_regcache_deadline(self, 0);
+    return intRet;
+}
+
+
+
+/**
+ *  usbiss_regcache_gap
+ *    allows rewriting cached registers to merge bursts
+ */
+int usbiss_regcache_gap( t_usbiss *self, uint8_t adr7, uint8_t gap )
+{
+    /** Variables **/
+    t_usbiss_regcache*  cache;  // register cache
+
+    /* check */
+    cache = (adr7 < USBISS_I2C_NUM_ADR) ? self->regcache[adr7] : NULL;
+    if ( (NULL == cache) || (gap > USBISS_REGCACHE_GAP) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: adr=0x%02x, gap=%u unsupported\n", __FUNCTION__, adr7, gap);
+        }
+        return -1;
+    }
+    cache->uint8Gap = gap;
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_regcache_flush
+ *    writes buffered registers
+ */
+int usbiss_regcache_flush( t_usbiss *self, uint8_t adr7 )
+{
+    /** Variables **/
+    int     intRet = 0;     // first failed flush
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* flush */
+    for ( uint8_t i = 0; i < USBISS_I2C_NUM_ADR; i++ ) {
+        if ( ((USBISS_REGCACHE_ALL == adr7) || (i == adr7)) && (NULL != self->regcache[i]) ) {
+            intRet = (0 == intRet) ? usbiss_regcache_flush_dev(self, i) : intRet;
+        }
+    }
+    usbiss_regcache_deadline(self, 0);
+    /* report failed deadline flush once */
+    intRet = (0 == intRet) ? self->intCacheEro : intRet;
+    self->intCacheEro = 0;
+    return intRet;
+}
+
+
+
+/**
+ *  usbiss_regcache_poll
+ *    flushes registers with expired write-back deadline
+ */
+int usbiss_regcache_poll( t_usbiss *self, uint32_t *sleepUs )
+{
+    /** Variables **/
+    uint64_t    uint64Now;  // current time
+    int         intRet;     // latched flush result
+
+    /* expired deadlines */
+    uint64Now = usbiss_time_us();
+    if ( (0 != self->uint64CacheFlush) && (uint64Now >= self->uint64CacheFlush) ) {
+        usbiss_regcache_deadline(self, uint64Now);
+    }
+    /* time until next deadline */
+    if ( NULL != sleepUs ) {
+        uint64Now = usbiss_time_us();
+        if ( 0 == self->uint64CacheFlush ) {
+            *sleepUs = UINT32_MAX;
+        } else {
+            *sleepUs = (self->uint64CacheFlush > uint64Now) ? (uint32_t) usbiss_min(self->uint64CacheFlush - uint64Now, (uint64_t) UINT32_MAX) : 0;
+        }
+    }
+    /* report failed deadline flush once */
+    intRet = self->intCacheEro;
+    self->intCacheEro = 0;
+    return intRet;
+}
+
+
+
+/**
+ *  usbiss_i2c_wr
+ *    write to I2C device
+ */
+int usbiss_i2c_wr( t_usbiss *self, uint8_t adr7, void* data, size_t len )
+{
+    /** Variables **/
+    t_usbiss_iovec  iov = {data, len};  // write data as segment
+
+    return usbiss_regcache_xfer(self, adr7, &iov, 1, NULL, 0);
+}
+
+
+
+/**
+ *  usbiss_i2c_rd
+ *    read from I2C device
+ */
+int usbiss_i2c_rd( t_usbiss *self, uint8_t adr7, void* data, size_t len )
+{
+    return usbiss_regcache_xfer(self, adr7, NULL, 0, data, len);
+}
+
+
+
+/**
+ *  usbiss_i2c_wr_rd
+ *    writes to i2c devices, sents repeated start for direction change and reads from i2c device
+ */
+int usbiss_i2c_wr_rd( t_usbiss *self, uint8_t adr7, void* data, size_t wrLen, size_t rdLen )
+{
+    /** Variables **/
+    t_usbiss_iovec  iov = {data, wrLen};    // write data as segment
+
+    /* empty frame provided */
+    if ( (0 == wrLen) || (0 == rdLen) ) {
+        return 0;
+    }
+    /* write data is transferred before read data overwrites them */
+    return usbiss_regcache_xfer(self, adr7, &iov, 1, data, rdLen);
+}
+
+
+
+/**
+ *  usbiss_i2c_wrv
+ *    write segments to I2C device
+ */
+int usbiss_i2c_wrv( t_usbiss *self, uint8_t adr7, const t_usbiss_iovec *iov, size_t iovNum )
+{
+    return usbiss_regcache_xfer(self, adr7, iov, iovNum, NULL, 0);
+}
+
+
+
+/**
+ *  usbiss_i2c_wrv_rd
+ *    write segments, repeated start and read into separate buffer
+ */
+int usbiss_i2c_wrv_rd( t_usbiss *self, uint8_t adr7, const t_usbiss_iovec *iov, size_t iovNum, void* rd, size_t rdLen )
+{
+    /* empty frame provided */
+    if ( (0 == usbiss_iov_len(iov, iovNum)) && (0 == rdLen) ) {
+        return 0;
+    }
+    return usbiss_regcache_xfer(self, adr7, iov, iovNum, rd, rdLen);
+}
+
+
+
+/**
+ *  usbiss_i2c_xfer
+ *    perform single I2C transfer
+ */
+int usbiss_i2c_xfer( t_usbiss *self, t_usbiss_i2c_xfer *xfer )
+{
+    /** Variables **/
+    t_usbiss_iovec  iov = {xfer->wr, xfer->wrLen};  // write data as segment
+
+    /* empty transfer */
+    if ( (0 == xfer->wrLen) && (0 == xfer->rdLen) ) {
+        xfer->intRet = 0;
+        return 0;
+    }
+    xfer->intRet = usbiss_regcache_xfer(self, xfer->uint8Adr7, &iov, 1, xfer->rd, xfer->rdLen);
+    return xfer->intRet;
+}
+
+
+
+/**
+ *  usbiss_i2c_xfer_batch
+ *    perform I2C transfers, grouped by I2C clock
+ */
+int usbiss_i2c_xfer_batch( t_usbiss *self, t_usbiss_i2c_xfer *xfer, size_t num )
+{
+    /** Variables **/
+    size_t      pend = num;     // number of pending transfers
+    size_t      first;          // first pending transfer
+    uint8_t     uint8Clk;       // I2C clock of current group
+    uint8_t     uint8Ok;        // current mode has pending transfers
+    int         intRet = 0;     // batch result
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* mark all as pending */
+    for ( size_t i = 0; i < num; i++ ) {
+        xfer[i].intRet = __INT_MAX__;
+    }
+    /* process clock groups */
+    while ( 0 != pend ) {
+        /* prefer current mode, avoids mode change */
+        first = num;
+        uint8Ok = 0;
+        for ( size_t i = 0; i < num; i++ ) {
+            if ( __INT_MAX__ != xfer[i].intRet ) {
+                continue;
+            }
+            if ( num == first ) {
+                first = i;
+            }
+            if ( self->uint8Mode == usbiss_i2c_clk_of(self, xfer[i].uint8Adr7) ) {
+                uint8Ok = 1;
+                break;
+            }
+        }
+        uint8Clk = (0 != uint8Ok) ? self->uint8Mode : usbiss_i2c_clk_of(self, xfer[first].uint8Adr7);
+        /* all transfers of group */
+        for ( size_t i = first; i < num; i++ ) {
+            if ( (__INT_MAX__ != xfer[i].intRet) || (uint8Clk != usbiss_i2c_clk_of(self, xfer[i].uint8Adr7)) ) {
+                continue;
+            }
+            if ( 0 != usbiss_i2c_xfer(self, &xfer[i]) ) {
+                if ( 0 != self->uint8MsgLevel ) {
+                    printf("  ERROR:%s: transfer %zu to adr=0x%02x failed, ero=0x%x\n", __FUNCTION__, i, xfer[i].uint8Adr7, xfer[i].intRet);
+                }
+                intRet = -1;
+            }
+            --pend;
+        }
+    }
+    /* graceful end */
+    return intRet;
+}
+
+
+
+/**
+ *  @brief transaction size
+ *
+ *  number of direct frame bytes of one START...STOP transaction, see
+ *  #usbiss_i2c_frame
+ *
+ *  @param[in]      xfer                transfer
+ *  @return         size_t              number of frame bytes, 0: transfer not in direct frame
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static size_t usbiss_i2c_frame_len( const t_usbiss_i2c_xfer *xfer )
+{
+    /** Variables **/
+    size_t  len;    // frame bytes
+
+    /* short transfers */
+    if ( ((0 == xfer->wrLen) && (0 == xfer->rdLen)) || (xfer->rdLen > USBISS_I2C_CHUNK) || (xfer->wrLen > USBISS_I2C_CHUNK) || !(xfer->uint8Adr7 < USBISS_I2C_NUM_ADR) ) {
+        return 0;
+    }
+    len = 3;    // START + WRITE + ADR
+    if ( 0 != xfer->wrLen ) {
+        len += 1 + xfer->wrLen; // WRITE + DATA
+        if ( 0 != xfer->rdLen ) {
+            len += 3;   // RESTART + WRITE + ADR
+        }
+    }
+    if ( 0 != xfer->rdLen ) {
+        if ( xfer->rdLen > 1 ) {
+            len += 1;   // READ of all but last byte
+        }
+        len += 2;   // NCK + READ
+    }
+    len += 1;   // STOP
+    return len;
+}
+
+
+
+/**
+ *  @brief packed transaction size
+ *
+ *  number of direct frame bytes of one transaction in #usbiss_i2c_xfer_pack
+ *
+ *  @param[in,out]  *self               common handle #t_usbiss
+ *  @param[in]      xfer                transfer
+ *  @return         size_t              number of frame bytes, 0: transfer not packable
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static size_t usbiss_i2c_pack_len( t_usbiss *self, const t_usbiss_i2c_xfer *xfer )
+{
+    /* only reads, frame abort is resolved by repeating them one by one; failed slaves go single, cached slaves keep their cache path */
+    if ( (0 == xfer->rdLen) || ((xfer->uint8Adr7 < USBISS_I2C_NUM_ADR) && ((0 != self->uint8NoPack[xfer->uint8Adr7]) || (NULL != self->regcache[xfer->uint8Adr7]))) ) {
+        return 0;
+    }
+    return usbiss_i2c_frame_len(xfer);
+}
+
+
+
+/**
+ *  @brief transaction
+ *
+ *  assembles one START...STOP transaction in direct frame, last read byte
+ *  is not acknowledged
+ *
+ *  @param[in]      xfer                transfer
+ *  @param[out]     *frame              direct frame buffer, #usbiss_i2c_frame_len bytes
+ *  @return         size_t              number of frame bytes
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static size_t usbiss_i2c_frame( const t_usbiss_i2c_xfer *xfer, uint8_t *frame )
+{
+    /** Variables **/
+    size_t  len = 0;    // frame bytes
+
+    frame[len++] = USBISS_I2C_START;
+    frame[len++] = USBISS_I2C_WRITE;
+    if ( 0 != xfer->wrLen ) {
+        frame[len++] = (uint8_t) ((xfer->uint8Adr7 << 1) | USBISS_I2C_WR);
+        frame[len++] = (uint8_t) (USBISS_I2C_WRITE + xfer->wrLen - 1);
+        memcpy(frame+len, xfer->wr, xfer->wrLen);
+        len += xfer->wrLen;
+        if ( 0 != xfer->rdLen ) {
+            frame[len++] = USBISS_I2C_RESTART;
+            frame[len++] = USBISS_I2C_WRITE;
+        }
+    }
+    if ( 0 != xfer->rdLen ) {
+        frame[len++] = (uint8_t) ((xfer->uint8Adr7 << 1) | USBISS_I2C_RD);
+        if ( xfer->rdLen > 1 ) {
+            frame[len++] = (uint8_t) (USBISS_I2C_READ + xfer->rdLen - 2);
+        }
+        frame[len++] = USBISS_I2C_NCK;
+        frame[len++] = USBISS_I2C_READ;
+    }
+    frame[len++] = USBISS_I2C_STOP;
+    return len;
+}
+
+
+
+/**
+ *  usbiss_i2c_xfer_pack
+ *    perform short I2C reads of many slaves in shared direct frames
+ */
+int usbiss_i2c_xfer_pack( t_usbiss *self, t_usbiss_i2c_xfer *xfer, size_t num )
+{
+    /** Variables **/
+    uint8_t     uint8Wr[USBISS_I2C_FRAME];  // direct frame
+    uint8_t     uint8Rd[USBISS_I2C_FRAME];  // status + number of read bytes + read data
+    size_t      wrLen;          // bytes in direct frame
+    size_t      rdLen;          // read bytes of direct frame
+    size_t      len;            // frame bytes of transfer
+    size_t      first;          // first transfer of frame
+    size_t      i = 0;          // current transfer
+    uint8_t     uint8Clk;       // I2C clock of frame
+    int         intFrame;       // frame result
+    int         intRet = 0;     // pack result
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* process list */
+    while ( i < num ) {
+        /* not packable, regular transfer */
+        if ( 0 == usbiss_i2c_pack_len(self, &xfer[i]) ) {
+            if ( 0 != usbiss_i2c_xfer(self, &xfer[i]) ) {
+                intRet = -1;
+            } else if ( xfer[i].uint8Adr7 < USBISS_I2C_NUM_ADR ) {
+                self->uint8NoPack[xfer[i].uint8Adr7] = 0;   // acknowledged again
+            }
+            ++i;
+            continue;
+        }
+        /* collect transactions of one clock profile */
+        first = i;
+        uint8Clk = usbiss_i2c_clk_of(self, xfer[first].uint8Adr7);
+        uint8Wr[0] = USBISS_I2C_DIRECT;
+        wrLen = 1;
+        rdLen = 0;
+        while ( i < num ) {
+            len = usbiss_i2c_pack_len(self, &xfer[i]);
+            if ( (0 == len) || (wrLen + len > sizeof(uint8Wr)) || (2 + rdLen + xfer[i].rdLen > sizeof(uint8Rd)) || (uint8Clk != usbiss_i2c_clk_of(self, xfer[i].uint8Adr7)) ) {
                 break;
             }
-            /* user message */
-            if ( 0 != self->uint8MsgLevel ) {
-                printf("  WARN:%s: scan i2c adr %02x, retry...\n", __FUNCTION__, i);
+            usbiss_i2c_mux_touch(self, xfer[i].uint8Adr7, xfer[i].wrLen);
+            wrLen += usbiss_i2c_frame(&xfer[i], uint8Wr+wrLen);
+            rdLen += xfer[i].rdLen;
+            ++i;
+        }
+        /* transfer frame */
+        intFrame = usbiss_i2c_frame_run(self, xfer[first].uint8Adr7, uint8Wr, wrLen, uint8Rd, rdLen);
+        /* split response */
+        if ( 0 == intFrame ) {
+            rdLen = 0;
+            for ( size_t j = first; j < i; j++ ) {
+                memcpy(xfer[j].rd, uint8Rd+2+rdLen, xfer[j].rdLen);
+                rdLen += xfer[j].rdLen;
+                xfer[j].intRet = 0;
             }
+            ++(self->uint32PackFrame);
+            self->uint32PackXfer += (uint32_t) (i - first);
+            continue;
         }
-        /* Stop Bit */
-        intRet = usbiss_i2c_stopbit(self);
-        if ( 0 != intRet ) {
-            if ( 0 != self->uint8MsgLevel ) {
-                printf("  ERROR:%s: Stopbit failed, ero=0x%02x, BUS mayby clamped\n", __FUNCTION__, intRet);
+        /* frame rejected, free bus and get state of every slave */
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  WARN:%s: frame with %zu transfers rejected, ero=0x%x, one by one\n", __FUNCTION__, i - first, intFrame);
+        }
+        ++(self->uint32PackFallback);
+        if ( (0 != self->uint8IsOpen) && (0 == self->uint8Lost) ) {
+            usbiss_i2c_stopbit(self);
+        }
+        for ( size_t j = first; j < i; j++ ) {
+            if ( 0 != usbiss_i2c_xfer(self, &xfer[j]) ) {
+                if ( 0 != self->uint8MsgLevel ) {
+                    printf("  ERROR:%s: transfer %zu to adr=0x%02x failed, ero=0x%x\n", __FUNCTION__, j, xfer[j].uint8Adr7, xfer[j].intRet);
+                }
+                self->uint8NoPack[xfer[j].uint8Adr7] = 1;   // keep out of next frames
+                intRet = -1;
             }
-            return -1;
         }
     }
-    /* finish */
-    return intNumI2c;
+    /* graceful end */
+    return intRet;
 }
 
 
 
 /**
- *  usbiss_i2c_wr
- *    write to I2C device
+ *  usbiss_i2c_mux_add
+ *    declare I2C multiplexer
  */
-int usbiss_i2c_wr( t_usbiss *self, uint8_t adr7, void* data, size_t len )
+int usbiss_i2c_mux_add( t_usbiss *self, uint8_t adr7, const char* part )
 {
     /** Variables **/
-    int             intRet;         // internal return code, allows to send stop bit in case of crash
+    const char* charPtrPart = (NULL != part) ? part : "PCA9548";    // part number
+    uint8_t     uint8Channels;  // downstream channels
+    uint8_t     uint8Enc;       // control register encoding
 
     /* Function Call Message */
     if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
-    /* empty frame provided */
-    if ( 0 == len ) {
-        return 0;
-    }
-    /* USBISS open? */
-    if ( !self->uint8IsOpen ) {
+    /* part */
+    if ( (NULL != strstr(charPtrPart, "9540")) || (NULL != strstr(charPtrPart, "9542")) ) {
+        uint8Channels = 2;
+        uint8Enc = 1;
+    } else if ( NULL != strstr(charPtrPart, "9544") ) {
+        uint8Channels = 4;
+        uint8Enc = 1;
+    } else if ( NULL != strstr(charPtrPart, "9543") ) {
+        uint8Channels = 2;
+        uint8Enc = 0;
+    } else if ( (NULL != strstr(charPtrPart, "9545")) || (NULL != strstr(charPtrPart, "9546")) ) {
+        uint8Channels = 4;
+        uint8Enc = 0;
+    } else if ( NULL != strstr(charPtrPart, "9548") ) {
+        uint8Channels = 8;
+        uint8Enc = 0;
+    } else {
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: USBISS connection not open\n", __FUNCTION__);
+            printf("  ERROR:%s: unsupported multiplexer '%s'\n", __FUNCTION__, charPtrPart);
         }
         return -1;
     }
-    /* I2C mode setted? */
-    if ( 0 != usbiss_is_i2c_mode(self->uint8Mode) ) {
+    /* already declared, or no space */
+    if ( !(adr7 < USBISS_I2C_NUM_ADR) || (0 <= usbiss_i2c_mux_find(self, adr7)) || !(self->uint8MuxNum < USBISS_I2C_MUX_MAX) ) {
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: USBISS is configured for non I2C mode\n", __FUNCTION__);
+            printf("  ERROR:%s: multiplexer adr=0x%02x invalid, duplicate or more than %i\n", __FUNCTION__, adr7, USBISS_I2C_MUX_MAX);
         }
         return -1;
     }
-    /* Startbit + ADR */
-    intRet = usbiss_i2c_startbit(self, (uint8_t) ((adr7 << 1) | USBISS_I2C_WR));
-    if ( 0 != intRet ) {
+    self->i2cMux[self->uint8MuxNum].uint8Adr7 = adr7;
+    self->i2cMux[self->uint8MuxNum].uint8Channels = uint8Channels;
+    self->i2cMux[self->uint8MuxNum].uint8Enc = uint8Enc;
+    self->i2cMux[self->uint8MuxNum].uint8Sel = USBISS_I2C_MUX_UNKNOWN;
+    ++(self->uint8MuxNum);
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_i2c_mux_select
+ *    enable multiplexer channel, written only on change
+ */
+int usbiss_i2c_mux_select( t_usbiss *self, uint8_t mux, uint8_t channel )
+{
+    /** Variables **/
+    int         intMux = usbiss_i2c_mux_find(self, mux);    // multiplexer index
+    uint8_t     uint8Want;  // requested channel of multiplexer
+    uint8_t     uint8Ctrl;  // control register
+    int         intRet;     // transfer result
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* check */
+    if ( (0 > intMux) || ((USBISS_I2C_MUX_OFF != channel) && !(channel < self->i2cMux[intMux].uint8Channels)) ) {
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: Startbit failed\n", __FUNCTION__);
+            printf("  ERROR:%s: multiplexer adr=0x%02x channel %i not declared\n", __FUNCTION__, mux, channel);
         }
-        return intRet;
+        return -1;
     }
-    /* Intermideate Packets, DATA */
-    intRet = usbiss_i2c_data_wr(self, data, len);
-    if ( 0 != intRet ) {
-        if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s:PKG: Packet Transfer ero=0x%x, go on with STOP BIT to free the bus\n", __FUNCTION__, intRet);
+    /* other multiplexers off first, avoids address conflicts between channels */
+    for ( uint8_t i = 0; i < self->uint8MuxNum; i++ ) {
+        uint8Want = (i == (uint8_t) intMux) ? channel : USBISS_I2C_MUX_OFF;
+        if ( uint8Want == self->i2cMux[i].uint8Sel ) {
+            continue;
         }
-    }
-    /* Stop Bit */
-    intRet = usbiss_i2c_stopbit(self);
-    if ( 0 != intRet ) {
-        if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: Stopbit failed, BUS mayby clamped\n", __FUNCTION__);
+        uint8Ctrl = usbiss_i2c_mux_ctrl(&self->i2cMux[i], uint8Want);
+        intRet = usbiss_i2c_wr(self, self->i2cMux[i].uint8Adr7, &uint8Ctrl, 1);
+        if ( 0 != intRet ) {
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  ERROR:%s: select multiplexer adr=0x%02x failed, ero=0x%x\n", __FUNCTION__, self->i2cMux[i].uint8Adr7, intRet);
+            }
+            return intRet;
         }
-        return intRet;
+        self->i2cMux[i].uint8Sel = uint8Want;
+        ++(self->uint32MuxSel);
     }
-    /* graceful end */
-    return intRet;
+    return 0;
 }
 
 
 
 /**
- *  usbiss_i2c_rd
- *    read from I2C device
+ *  usbiss_i2c_mux_xfer
+ *    perform I2C transfer behind multiplexer, select in same frame
  */
-int usbiss_i2c_rd( t_usbiss *self, uint8_t adr7, void* data, size_t len )
+int usbiss_i2c_mux_xfer( t_usbiss *self, uint8_t mux, uint8_t channel, t_usbiss_i2c_xfer *xfer )
 {
     /** Variables **/
-    int             intRet;         // internal return code, allows to send stop bit in case of crash
+    uint8_t         uint8Wr[USBISS_I2C_FRAME];  // direct frame
+    uint8_t         uint8Rd[USBISS_I2C_FRAME];  // status + number of read bytes + read data
+    t_usbiss_iovec  iov = {xfer->wr, xfer->wrLen};  // write data as segment
+    uint8_t         uint8Want;      // requested channel of multiplexer
+    uint8_t         uint8Sel = 0;   // number of select writes
+    uint8_t         uint8Frame = 1; // selects and transfer in one direct frame
+    uint8_t         uint8Clk;       // I2C clock of device
+    size_t          wrLen = 1;      // bytes in direct frame
+    size_t          len;            // frame bytes of transfer
+    int             intMux = -1;    // multiplexer index, -1: root bus
+    int             intRet;         // transfer result
 
     /* Function Call Message */
     if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
-    /* empty frame provided */
-    if ( 0 == len ) {
-        return 0;
+    /* check, root bus disables all channels */
+    if ( USBISS_I2C_MUX_ROOT != mux ) {
+        intMux = usbiss_i2c_mux_find(self, mux);
+        if ( (0 > intMux) || !(channel < self->i2cMux[intMux].uint8Channels) ) {
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  ERROR:%s: multiplexer adr=0x%02x channel %i not declared\n", __FUNCTION__, mux, channel);
+            }
+            xfer->intRet = -1;
+            return -1;
+        }
+    } else if ( (xfer->uint8Adr7 < USBISS_I2C_NUM_ADR) && (NULL != self->regcache[xfer->uint8Adr7]) ) {
+        uint8Frame = 0;     // root bus device keeps its register cache
     }
-    /* USBISS open? */
-    if ( !self->uint8IsOpen ) {
-        if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: USBISS connection not open\n", __FUNCTION__);
+    /* select writes: requested channel, all other multiplexers off */
+    uint8Clk = usbiss_i2c_clk_of(self, xfer->uint8Adr7);
+    uint8Wr[0] = USBISS_I2C_DIRECT;
+    for ( uint8_t i = 0; i < self->uint8MuxNum; i++ ) {
+        uint8Want = ((int) i == intMux) ? channel : USBISS_I2C_MUX_OFF;
+        if ( uint8Want == self->i2cMux[i].uint8Sel ) {
+            continue;
         }
-        return -1;
+        ++uint8Sel;
+        if ( (wrLen + 6 > sizeof(uint8Wr)) || (uint8Clk != usbiss_i2c_clk_of(self, self->i2cMux[i].uint8Adr7)) ) {
+            uint8Frame = 0;     // frame requires same I2C clock
+            continue;
+        }
+        uint8Wr[wrLen++] = USBISS_I2C_START;
+        uint8Wr[wrLen++] = USBISS_I2C_WRITE;
+        uint8Wr[wrLen++] = (uint8_t) ((self->i2cMux[i].uint8Adr7 << 1) | USBISS_I2C_WR);
+        uint8Wr[wrLen++] = USBISS_I2C_WRITE;
+        uint8Wr[wrLen++] = usbiss_i2c_mux_ctrl(&self->i2cMux[i], uint8Want);
+        uint8Wr[wrLen++] = USBISS_I2C_STOP;
     }
-    /* I2C mode setted? */
-    if ( 0 != usbiss_is_i2c_mode(self->uint8Mode) ) {
+    if ( 0 == uint8Sel ) {
+        ++(self->uint32MuxHit);     // channel already selected
+    }
+    /* missing selects and transfer in one frame */
+    len = usbiss_i2c_frame_len(xfer);
+    if ( (0 != uint8Frame) && (0 != len) && !(wrLen + len > sizeof(uint8Wr)) && !(2 + xfer->rdLen > sizeof(uint8Rd)) ) {
+        wrLen += usbiss_i2c_frame(xfer, uint8Wr+wrLen);
+        intRet = usbiss_i2c_frame_run(self, xfer->uint8Adr7, uint8Wr, wrLen, uint8Rd, xfer->rdLen);
+        if ( 0 == intRet ) {
+            for ( uint8_t i = 0; i < self->uint8MuxNum; i++ ) {
+                self->i2cMux[i].uint8Sel = ((int) i == intMux) ? channel : USBISS_I2C_MUX_OFF;
+            }
+            self->uint32MuxSel += uint8Sel;
+            usbiss_i2c_mux_touch(self, xfer->uint8Adr7, xfer->wrLen);
+            if ( 0 != xfer->rdLen ) {
+                memcpy(xfer->rd, uint8Rd+2, xfer->rdLen);
+            }
+            xfer->intRet = 0;
+            return 0;
+        }
+        /* frame aborted, state of multiplexers unknown, get result step by step */
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: USBISS is configured for non I2C mode\n", __FUNCTION__);
+            printf("  WARN:%s: frame rejected, ero=0x%x, select separately\n", __FUNCTION__, intRet);
+        }
+        if ( 0 != uint8Sel ) {
+            usbiss_i2c_mux_invalidate(self);
+        }
+        if ( (0 != self->uint8IsOpen) && (0 == self->uint8Lost) ) {
+            usbiss_i2c_stopbit(self);
         }
-        return -1;
     }
-    /* Startbit + ADR */
-    intRet = usbiss_i2c_startbit(self, (uint8_t) ((adr7 << 1) | USBISS_I2C_RD));
-    if ( 0 != intRet ) {
-        if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: Startbit failed\n", __FUNCTION__);
+    /* select, then transfer */
+    if ( 0 != self->uint8MuxNum ) {
+        intRet = usbiss_i2c_mux_select(self, (0 > intMux) ? self->i2cMux[0].uint8Adr7 : mux, (0 > intMux) ? USBISS_I2C_MUX_OFF : channel);
+        if ( 0 != intRet ) {
+            xfer->intRet = intRet;
+            return intRet;
         }
-        return intRet;
     }
-    /* Intermideate Packets, read DATA */
-    intRet = usbiss_i2c_data_rd(self, data, len);
-    if ( 0 != intRet ) {
-        if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s:PKG: Packet Transfer ero=0x%x, go on with STOP BIT to free the bus\n", __FUNCTION__, intRet);
+    if ( 0 > intMux ) {
+        return usbiss_i2c_xfer(self, xfer);
+    }
+    /* devices behind channels bypass the register cache, it is kept per address */
+    xfer->intRet = ((0 == xfer->wrLen) && (0 == xfer->rdLen)) ? 0 : usbiss_i2c_retry(self, xfer->uint8Adr7, &iov, 1, xfer->rd, xfer->rdLen);
+    return xfer->intRet;
+}
+
+
+
+/**
+ *  usbiss_i2c_mux_scan
+ *    scan root bus and all multiplexer channels
+ */
+int usbiss_i2c_mux_scan( t_usbiss *self, int8_t start, int8_t stop, t_usbiss_i2c_route* dev, size_t len )
+{
+    /** Variables **/
+    int8_t      int8I2c[USBISS_I2C_NUM_ADR];        // found addresses of one bus
+    uint8_t     uint8Root[USBISS_I2C_NUM_ADR] = {0};    // address found on root bus
+    size_t      num = 0;        // found devices
+    int         intNum;         // found addresses of one bus
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* root bus, all channels off */
+    if ( (0 != self->uint8MuxNum) && (0 != usbiss_i2c_mux_select(self, self->i2cMux[0].uint8Adr7, USBISS_I2C_MUX_OFF)) ) {
+        return -1;
+    }
+    intNum = usbiss_i2c_scan(self, start, stop, int8I2c, (uint8_t) sizeof(int8I2c));
+    if ( 0 > intNum ) {
+        return -1;
+    }
+    for ( int i = 0; i < intNum; i++ ) {
+        if ( !(num < len) ) {
+            if ( 0 != self->uint8MsgLevel ) {
+                printf("  ERROR:%s: not enough memory\n", __FUNCTION__);
+            }
+            return -1;
         }
+        uint8Root[(uint8_t) int8I2c[i]] = 1;
+        dev[num].uint8Mux = USBISS_I2C_MUX_ROOT;
+        dev[num].uint8Channel = 0;
+        dev[num].uint8Adr7 = (uint8_t) int8I2c[i];
+        ++num;
     }
-    /* Stop Bit */
-    intRet = usbiss_i2c_stopbit(self);
-    if ( 0 != intRet ) {
-        if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: Stopbit failed, BUS mayby clamped\n", __FUNCTION__);
+    /* every channel, devices of root bus are visible on all channels */
+    for ( uint8_t i = 0; i < self->uint8MuxNum; i++ ) {
+        for ( uint8_t j = 0; j < self->i2cMux[i].uint8Channels; j++ ) {
+            if ( 0 != usbiss_i2c_mux_select(self, self->i2cMux[i].uint8Adr7, j) ) {
+                return -1;
+            }
+            intNum = usbiss_i2c_scan(self, start, stop, int8I2c, (uint8_t) sizeof(int8I2c));
+            if ( 0 > intNum ) {
+                return -1;
+            }
+            for ( int k = 0; k < intNum; k++ ) {
+                if ( 0 != uint8Root[(uint8_t) int8I2c[k]] ) {
+                    continue;
+                }
+                if ( !(num < len) ) {
+                    if ( 0 != self->uint8MsgLevel ) {
+                        printf("  ERROR:%s: not enough memory\n", __FUNCTION__);
+                    }
+                    return -1;
+                }
+                dev[num].uint8Mux = self->i2cMux[i].uint8Adr7;
+                dev[num].uint8Channel = j;
+                dev[num].uint8Adr7 = (uint8_t) int8I2c[k];
+                ++num;
+            }
         }
-        return intRet;
     }
-    /* graceful end */
-    return intRet;
+    /* all channels off */
+    if ( (0 != self->uint8MuxNum) && (0 != usbiss_i2c_mux_select(self, self->i2cMux[0].uint8Adr7, USBISS_I2C_MUX_OFF)) ) {
+        return -1;
+    }
+    return (int) num;
 }
 
 
 
 /**
- *  usbiss_i2c_wr_rd
- *    writes to i2c devices, sents repeated start for direction change and reads from i2c device
+ *  usbiss_i2c_qualify
+ *    measures I2C modes and selects fastest reliable one
  */
-int usbiss_i2c_wr_rd( t_usbiss *self, uint8_t adr7, void* data, size_t wrLen, size_t rdLen )
+int usbiss_i2c_qualify( t_usbiss *self, t_usbiss_i2c_qual *qual )
 {
     /** Variables **/
-    int     intRet = 0;     // internal return code, allows to send stop bit in case of crash
+    t_usbiss_i2c_xfer   xfer;               // pattern transfer
+    t_usbiss_iovec      iov;                // pattern write data as segment
+    uint8_t*            uint8PtrRd;         // read data
+    uint8_t*            uint8PtrRef;        // reference read data
+    uint8_t             uint8RefVld = 0;    // reference captured
+    uint8_t             uint8ClkSave;       // I2C clock profile before qualification
+    uint32_t            uint32Iter;         // repetitions per mode
+    uint64_t            uint64Time;         // measured time per mode
+    int                 intBest = -1;       // fastest reliable mode
+    int                 intRet;             // transfer result
 
     /* Function Call Message */
     if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
-    /* empty frame provided */
-    if ( (0 == wrLen) || (0 == rdLen) ) {
-        return 0;
-    }
     /* USBISS open? */
     if ( !self->uint8IsOpen ) {
         if ( 0 != self->uint8MsgLevel ) {
@@ -1318,49 +4121,169 @@ int usbiss_i2c_wr_rd( t_usbiss *self, uint8_t adr7, void* data, size_t wrLen, si
         }
         return -1;
     }
-    /* I2C mode setted? */
-    if ( 0 != usbiss_is_i2c_mode(self->uint8Mode) ) {
+    /* empty pattern */
+    if ( (0 == qual->wrLen) && (0 == qual->rdLen) ) {
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: USBISS is configured for non I2C mode\n", __FUNCTION__);
+            printf("  ERROR:%s: empty pattern\n", __FUNCTION__);
         }
         return -1;
     }
-    /* Startbit + ADR */
-    intRet |= usbiss_i2c_startbit(self, (uint8_t) ((adr7 << 1) | USBISS_I2C_WR));
-    if ( 0 != intRet ) {
+    /* allocate read buffers */
+    uint8PtrRd = malloc(usbiss_max(qual->rdLen, (size_t) 1));
+    uint8PtrRef = malloc(usbiss_max(qual->rdLen, (size_t) 1));
+    if ( (NULL == uint8PtrRd) || (NULL == uint8PtrRef) ) {
+        free(uint8PtrRd);
+        free(uint8PtrRef);
+        return -1;
+    }
+    /* prepare */
+    uint32Iter = (0 != qual->uint32Iter) ? qual->uint32Iter : USBISS_I2C_QUAL_ITER;
+    uint8ClkSave = self->uint8I2cClk[qual->uint8Adr7 & 0x7f];
+    xfer.uint8Adr7 = qual->uint8Adr7;
+    xfer.wr = qual->wr;
+    xfer.wrLen = qual->wrLen;
+    xfer.rd = uint8PtrRd;
+    xfer.rdLen = qual->rdLen;
+    iov.base = xfer.wr;
+    iov.len = xfer.wrLen;
+    /* iterate over modes, slowest first */
+    for ( uint8_t i = 0; i < USBISS_I2C_NUM_CLK; i++ ) {
+        /* init result */
+        qual->mode[i].uint8Mode = usbiss_i2c_clk_ladder[i];
+        qual->mode[i].uint32Xfer = 0;
+        qual->mode[i].uint32Nack = 0;
+        qual->mode[i].uint32Ero = 0;
+        qual->mode[i].uint32Us = 0;
+        qual->mode[i].uint32Bps = 0;
+        /* run pattern with temporary clock profile */
+        self->uint8I2cClk[qual->uint8Adr7 & 0x7f] = usbiss_i2c_clk_ladder[i];
+        uint64Time = usbiss_time_us();
+        for ( uint32_t j = 0; j < uint32Iter; j++ ) {
+            intRet = usbiss_i2c_retry(self, xfer.uint8Adr7, &iov, 1, xfer.rd, xfer.rdLen);  // bypasses register cache
+            ++(qual->mode[i].uint32Xfer);
+            if ( USBISS_ERO_ID1 == intRet ) {
+                ++(qual->mode[i].uint32Nack);
+            } else if ( 0 != intRet ) {
+                ++(qual->mode[i].uint32Ero);
+                usbiss_resync(self);    // align stream again
+            } else if ( (0 != qual->uint8Cmp) && (0 != qual->rdLen) ) {
+                if ( 0 == uint8RefVld ) {   // first good read is reference
+                    memcpy(uint8PtrRef, uint8PtrRd, qual->rdLen);
+                    uint8RefVld = 1;
+                } else if ( 0 != memcmp(uint8PtrRef, uint8PtrRd, qual->rdLen) ) {
+                    ++(qual->mode[i].uint32Ero);
+                }
+            }
+        }
+        uint64Time = usbiss_max(usbiss_time_us() - uint64Time, (uint64_t) 1);
+        qual->mode[i].uint32Us = (uint32_t) (uint64Time / uint32Iter);
+        qual->mode[i].uint32Bps = (uint32_t) ((((uint64_t) (qual->wrLen + qual->rdLen)) * uint32Iter * 1000000) / uint64Time);
+        /* user message */
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: Startbit failed\n", __FUNCTION__);
+            printf  (   "  INFO:%s: adr=0x%02x, mode=%s, xfer=%u, nack=%u, ero=%u, t=%uus, %uB/s\n",
+                        __FUNCTION__, qual->uint8Adr7, usbiss_mode_to_human(qual->mode[i].uint8Mode),
+                        qual->mode[i].uint32Xfer, qual->mode[i].uint32Nack, qual->mode[i].uint32Ero,
+                        qual->mode[i].uint32Us, qual->mode[i].uint32Bps
+                    );
+        }
+        /* reliable? */
+        if ( !((qual->mode[i].uint32Nack + qual->mode[i].uint32Ero) > qual->uint32Tol) ) {
+            intBest = (int) usbiss_i2c_clk_ladder[i];
         }
-        return intRet;
     }
-    /* Write data */
-    intRet |= usbiss_i2c_data_wr(self, data, wrLen);
-    if ( 0 != intRet ) {
+    /* release memory */
+    free(uint8PtrRd);
+    free(uint8PtrRef);
+    /* register result as clock profile */
+    if ( 0 > intBest ) {
+        self->uint8I2cClk[qual->uint8Adr7 & 0x7f] = uint8ClkSave;
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s:PKG: Packet Transfer ero=0x%x, go on with STOP BIT to free the bus\n", __FUNCTION__, intRet);
+            printf("  ERROR:%s: no reliable mode for adr=0x%02x\n", __FUNCTION__, qual->uint8Adr7);
         }
+        return -1;
     }
-    /* Repeated start + ADR, changes direction to read */
-    intRet |= usbiss_i2c_restartbit(self, (uint8_t) ((adr7 << 1) | USBISS_I2C_RD));
-    if ( 0 != intRet ) {
+    self->uint8I2cClk[qual->uint8Adr7 & 0x7f] = (uint8_t) intBest;
+    /* graceful end */
+    return intBest;
+}
+
+
+
+/**
+ *  usbiss_i2c_clk_save
+ *    store I2C clock profiles in file
+ */
+int usbiss_i2c_clk_save( t_usbiss *self, const char* path )
+{
+    /** Variables **/
+    char    charText[USBISS_I2C_NUM_ADR*40];    // profiles of this adapter
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* serial number required */
+    if ( '\0' == self->charSerial[0] ) {
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: Startbit failed\n", __FUNCTION__);
+            printf("  ERROR:%s: USBISS serial unknown, open adapter first\n", __FUNCTION__);
         }
+        return -1;
     }
-    /* Read DATA */
-    intRet |= usbiss_i2c_data_rd(self, data, rdLen);
-    if ( 0 != intRet ) {
+    /* profiles of this adapter */
+    charText[0] = '\0';
+    for ( uint8_t i = 0; i < USBISS_I2C_NUM_ADR; i++ ) {
+        if ( USBISS_IO_MODE != self->uint8I2cClk[i] ) {
+            snprintf(charText+strlen(charText), sizeof(charText)-strlen(charText), "%s 0x%02x %s\n", self->charSerial, i, usbiss_mode_to_human(self->uint8I2cClk[i]));
+        }
+    }
+    /* keep profiles of other adapters */
+    if ( 0 != usbiss_file_replace(path, self->charSerial, charText) ) {
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s:PKG: Packet Transfer ero=0x%x, go on with STOP BIT to free the bus\n", __FUNCTION__, intRet);
+            printf("  ERROR:%s: open '%s' for write\n", __FUNCTION__, path);
         }
+        return -1;
     }
-    /* Stop Bit */
-    intRet |= usbiss_i2c_stopbit(self);
-    if ( 0 != intRet ) {
+    /* graceful end */
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_i2c_clk_load
+ *    load I2C clock profiles from file
+ */
+int usbiss_i2c_clk_load( t_usbiss *self, const char* path )
+{
+    /** Variables **/
+    FILE*   fh;             // file handle
+    char    charLine[128];  // line buffer
+    char    charSerial[16]; // serial number
+    char    charMode[32];   // I2C mode
+    int     intAdr;         // I2C address
+    int     intNum = 0;     // number of loaded profiles
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* open file */
+    fh = fopen(path, "r");
+    if ( NULL == fh ) {
         if ( 0 != self->uint8MsgLevel ) {
-            printf("  ERROR:%s: Stopbit failed, BUS mayby clamped\n", __FUNCTION__);
+            printf("  ERROR:%s: open '%s'\n", __FUNCTION__, path);
+        }
+        return -1;
+    }
+    /* process lines */
+    while ( NULL != fgets(charLine, sizeof(charLine), fh) ) {
+        if ( 3 != sscanf(charLine, "%15s %i %31s", charSerial, &intAdr, charMode) ) {
+            continue;
+        }
+        if ( 0 != strcmp(charSerial, self->charSerial) ) {
+            continue;
+        }
+        if ( 0 == usbiss_i2c_set_clk(self, (uint8_t) (intAdr & 0x7f), charMode) ) {
+            ++intNum;
         }
     }
+    fclose(fh);
     /* graceful end */
-    return intRet;
+    return intNum;
 }
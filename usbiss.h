@@ -36,6 +36,10 @@
 #define USBISS_VCP_VID          "04d8"      /**< USB-ISS Virtual COM Port Vendor ID */
 #define USBISS_VCP_PID          "ffee"      /**< USB-ISS Virtual COM Port Device/Product ID */
 #define USBISS_I2C_SCAN_RETRY   (3)         /**< In I2C Scan numb er of retries before giving up, f.e. bus is occupied by another master */
+#define USBISS_I2C_NUM_ADR      (128)       /**< number of 7bit I2C slave addresses */
+#define USBISS_I2C_NUM_CLK      (7)         /**< number of I2C transfer modes */
+#define USBISS_I2C_TEST_BURST   (8)         /**< maximum number of I2C address tests per USB request */
+#define USBISS_I2C_QUAL_ITER    (100)       /**< default number of pattern repetitions per I2C mode in qualification */
 /** @} */   // USBISS_MISC
 
 
@@ -53,6 +57,7 @@
 #define USBISS_ISS_VERSION  0x01    /**< Returns 3 bytes, the module ID (7), firmware version (currently 2), and the current operating mode. */
 #define USBISS_SET_ISS_MODE 0x02    /**< Sets operating mode, I2C/SPI/Serial etc. */
 #define USBISS_GET_SER_NUM  0x03    /**< Returns the modules unique 8 byte USB serial number. */
+#define USBISS_I2C_TEST     0x58    /**< Checks for ACK of I2C address, returns non-zero if device acknowledged */
 #define USBISS_CMD_ACK      0xFF    /**< mode setting frames accepted */
 #define USBISS_CMD_NCK      0x00    /**< mode setting frame not accepted */
 /** @} */   // USBISS_CMD
@@ -91,6 +96,7 @@
  *  @{
  */
 #define USBISS_I2C_CHUNK    (16)    /**< Maximum chunk size for packet */
+#define USBISS_I2C_FRAME    (60)    /**< Maximum size of direct frame including command, also maximum response */
 #define USBISS_I2C_START    (0x01)  /**< send start sequence */
 #define USBISS_I2C_RESTART  (0x02)  /**< send restart sequence */
 #define USBISS_I2C_STOP     (0x03)  /**< send stop sequence */
@@ -114,6 +120,20 @@
 
 
 
+/**
+ *  @defgroup USBISS_I2C_MUX
+ *  I2C multiplexer PCA954x
+ *
+ *  @{
+ */
+#define USBISS_I2C_MUX_MAX      (8)     /**< maximum number of multiplexers on root bus */
+#define USBISS_I2C_MUX_ROOT     (0xff)  /**< multiplexer address of devices on root bus */
+#define USBISS_I2C_MUX_OFF      (0xfe)  /**< channel: all channels disabled */
+#define USBISS_I2C_MUX_UNKNOWN  (0xff)  /**< channel: state unknown, next select is written */
+/** @} */   // USBISS_I2C_MUX
+
+
+
 /**
  *  @defgroup USBISS_ERROR
  *  USBISS Error Codes
@@ -140,6 +160,64 @@
 
 
 
+/**
+ *  @defgroup USBISS_RETRY
+ *  Retry policy for I2C transfers, see #t_usbiss_retry
+ *
+ *  @{
+ */
+#define USBISS_RETRY_XFER       (0)         /**< retry whole transaction */
+#define USBISS_RETRY_CHUNK      (1)         /**< write-read: resume at first unread byte, write data is big endian register address */
+#define USBISS_RETRY_ERO_NUM    (16)        /**< error codes in retryable error mask, larger codes are never retried */
+#define USBISS_RETRY_ERO(ero)   ((uint16_t) (1 << (ero)))   /**< retryable error mask, 0: driver/UART failure (-1), n: USB-ISS error n < #USBISS_RETRY_ERO_NUM */
+#define USBISS_RETRY_ERO_DFLT   (USBISS_RETRY_ERO(0) | USBISS_RETRY_ERO(USBISS_ERO_ID2) | USBISS_RETRY_ERO(USBISS_ERO_ID3) | USBISS_RETRY_ERO(USBISS_ERO_ID6) | USBISS_RETRY_ERO(USBISS_ERO_ID7))    /**< default retryable errors, NACK is excluded */
+#define USBISS_RECOVER_CLK      (9)         /**< number of clocked bytes to free stuck slave */
+/** @} */   // USBISS_RETRY
+
+
+
+/**
+ *  @defgroup USBISS_RESYNC
+ *  Timing of UART stream re-synchronization, see #usbiss_resync
+ *
+ *  @{
+ */
+#define USBISS_RESYNC_QUIET_US  (5000)      /**< line needs to be quiet for this time to finish drain */
+#define USBISS_RESYNC_TMO_US    (100000)    /**< maximum drain time and response timeout of probe */
+#define USBISS_RESYNC_PROBE     (3)         /**< number of version probes */
+#define USBISS_RESYNC_POLL_US   (100)       /**< UART poll interval */
+/** @} */   // USBISS_RESYNC
+
+
+
+/**
+ *  @defgroup USBISS_HOTPLUG
+ *  Reconnect of re-enumerated adapter, see #usbiss_hotplug_enable
+ *
+ *  @{
+ */
+#define USBISS_HOTPLUG_LOST     (-2)        /**< adapter lost, retry transfer after reconnect */
+#define USBISS_HOTPLUG_RETRY_US (100000)    /**< minimal time between reconnect attempts without device event */
+/** @} */   // USBISS_HOTPLUG
+
+
+
+/**
+ *  @defgroup USBISS_REGCACHE
+ *  Register attributes of register cache, see #usbiss_regcache_enable
+ *
+ *  @{
+ */
+#define USBISS_REG_VOLATILE     (0)         /**< always transferred, not cached */
+#define USBISS_REG_CACHE        (1)         /**< read once, writes update cache */
+#define USBISS_REG_WRITE        (2)         /**< write-through, cache filled by writes only, reads before first write are transferred */
+#define USBISS_REGCACHE_ALL     (0xff)      /**< all devices, see #usbiss_regcache_invalidate */
+#define USBISS_REGCACHE_BURST   (48)        /**< maximum data bytes of merged write burst, fits with 2 address bytes into one #USBISS_I2C_FRAME */
+#define USBISS_REGCACHE_GAP     (4)         /**< maximum cached registers between buffered writes rewritten to merge bursts, see #usbiss_regcache_gap */
+/** @} */   // USBISS_REGCACHE
+
+
+
 /**
  *  @defgroup MIN_MAX
  *
@@ -163,6 +241,73 @@
 
 
 
+/**
+ *  @typedef t_usbiss_retry
+ *
+ *  @brief  retry policy
+ *
+ *  retry and bus recovery policy for I2C transfers
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_retry {
+    uint8_t     uint8Attempts;      /**<  maximum number of attempts per transfer, 1: no retry */
+    uint32_t    uint32BackoffUs;    /**<  wait time before first retry in us */
+    uint8_t     uint8BackoffMul;    /**<  backoff multiplier per retry */
+    uint32_t    uint32BackoffMaxUs; /**<  upper limit of backoff time in us */
+    uint16_t    uint16Retryable;    /**<  retryable errors, #USBISS_RETRY_ERO */
+    uint8_t     uint8Resume;        /**<  #USBISS_RETRY_XFER or #USBISS_RETRY_CHUNK */
+    uint8_t     uint8Recover;       /**<  1: run #usbiss_i2c_recover before retry */
+} t_usbiss_retry;
+
+
+
+/**
+ *  @typedef t_usbiss_regcache
+ *
+ *  @brief  register cache
+ *
+ *  register values of one I2C device with auto-incremented 8bit registers,
+ *  the register address is sent big endian in front of data
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_regcache {
+    uint8_t     uint8AdrBytes;      /**<  number of register address bytes, 1 or 2 */
+    uint32_t    uint32Num;          /**<  number of registers */
+    uint8_t*    uint8PtrFlag;       /**<  per register attribute #USBISS_REGCACHE and valid flag */
+    uint8_t*    uint8PtrVal;        /**<  per register cached value */
+    uint8_t     uint8WrBack;        /**<  1: register writes buffered until flush */
+    uint8_t     uint8Gap;           /**<  cached registers between buffered writes rewritten to merge bursts, 0: only adjacent */
+    uint32_t    uint32DeadlineUs;   /**<  buffered writes are flushed after this time, 0: only by flush */
+    uint64_t    uint64Dirty;        /**<  time of oldest buffered write in us, 0: none */
+    uint32_t    uint32DirtyLo;      /**<  lowest buffered register */
+    uint32_t    uint32DirtyHi;      /**<  highest buffered register */
+} t_usbiss_regcache;
+
+
+
+/**
+ *  @typedef t_usbiss_i2c_mux
+ *
+ *  @brief  I2C multiplexer
+ *
+ *  PCA954x on root bus with cached channel selection
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_i2c_mux {
+    uint8_t     uint8Adr7;          /**<  Seven Bit I2C address of multiplexer */
+    uint8_t     uint8Channels;      /**<  number of downstream channels */
+    uint8_t     uint8Enc;           /**<  1: channel number with enable bit (PCA9540/2/4), 0: channel mask */
+    uint8_t     uint8Sel;           /**<  selected channel, #USBISS_I2C_MUX_OFF or #USBISS_I2C_MUX_UNKNOWN */
+} t_usbiss_i2c_mux;
+
+
+
 /**
  *  @typedef t_usbiss
  *
@@ -182,11 +327,135 @@ typedef struct t_usbiss {
     uint8_t             uint8Mode;          /**<  current mode */
     char                charSerial[10];     /**<  serial number */
     uint8_t             uint8IsOpen;        /**<  connection to usbiss is open */
+    uint8_t             uint8ModeDflt;      /**<  mode for slaves without clock profile, set by #usbiss_set_mode */
+    uint8_t             uint8I2cClk[USBISS_I2C_NUM_ADR];    /**<  per slave I2C clock profile, #USBISS_IO_MODE: no profile */
+    uint32_t            uint32ModeSwitch;   /**<  number of issued SET_ISS_MODE requests */
+    t_usbiss_retry      retry;              /**<  retry policy of I2C transfers */
+    uint32_t            uint32Retry;        /**<  number of retried I2C transfers */
+    uint32_t            uint32Recover;      /**<  number of bus recoveries */
+    size_t              sizeRdDone;         /**<  received read bytes of last I2C transfer */
+    uint32_t            uint32Resync;       /**<  number of UART stream re-synchronizations */
+    uint32_t            uint32ResyncFail;   /**<  number of failed re-synchronizations */
+    char                charCache[128];     /**<  handshake cache file, empty: disabled */
+    uint8_t             uint8Hotplug;       /**<  1: reconnect re-enumerated adapter */
+    int                 intHotplugFd;       /**<  device node watch, -1: polling */
+    uint8_t             uint8Lost;          /**<  1: adapter lost, waits for reconnect */
+    uint8_t             uint8ModeRestore;   /**<  transfer mode before adapter was lost */
+    uint8_t             uint8ModeDfltRestore;   /**<  default transfer mode before adapter was lost */
+    uint64_t            uint64HotplugTry;   /**<  earliest time of next reconnect attempt in us */
+    uint32_t            uint32Reconnect;    /**<  number of reconnects */
+    char                charUsbSerial[32];  /**<  USB serial number, identifies adapter on reconnect */
+    t_usbiss_regcache*  regcache[USBISS_I2C_NUM_ADR];   /**<  per slave register cache, NULL: disabled */
+    uint32_t            uint32CacheHit;     /**<  reads served by register cache */
+    uint32_t            uint32CacheMiss;    /**<  register reads of cached devices transferred */
+    uint32_t            uint32CacheWrBuf;   /**<  buffered register writes */
+    uint32_t            uint32CacheBurst;   /**<  write bursts of flushed registers */
+    uint64_t            uint64CacheFlush;   /**<  earliest write-back deadline in us, 0: none */
+    int                 intCacheEro;        /**<  first failed deadline flush, reported by #usbiss_regcache_poll */
+    uint32_t            uint32PackFrame;    /**<  direct frames with packed transfers */
+    uint32_t            uint32PackXfer;     /**<  transfers completed in packed frames */
+    uint32_t            uint32PackFallback; /**<  rejected packed frames, transfers performed one by one */
+    uint8_t             uint8NoPack[USBISS_I2C_NUM_ADR];    /**<  1: slave failed after rejected frame, not packed until acknowledged again */
+    t_usbiss_i2c_mux    i2cMux[USBISS_I2C_MUX_MAX]; /**<  declared multiplexers */
+    uint8_t             uint8MuxNum;        /**<  number of declared multiplexers */
+    uint32_t            uint32MuxSel;       /**<  channel select writes */
+    uint32_t            uint32MuxHit;       /**<  transfers with already selected channel */
 
 } t_usbiss;
 
 
 
+/**
+ *  @typedef t_usbiss_i2c_xfer
+ *
+ *  @brief  I2C transfer
+ *
+ *  describes one I2C transaction for #usbiss_i2c_xfer, #usbiss_i2c_xfer_batch
+ *  and #usbiss_i2c_xfer_pack,
+ *  write and read data are kept in separate buffers
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_i2c_xfer {
+    uint8_t     uint8Adr7;  /**<  Seven Bit I2C address */
+    void*       wr;         /**<  write data, can be NULL if wrLen is zero */
+    size_t      wrLen;      /**<  number of bytes to write */
+    void*       rd;         /**<  read data, can be NULL if rdLen is zero */
+    size_t      rdLen;      /**<  number of bytes to read */
+    int         intRet;     /**<  transfer result, see #usbiss_i2c_wr_rd */
+} t_usbiss_i2c_xfer;
+
+
+
+/**
+ *  @typedef t_usbiss_iovec
+ *
+ *  @brief  write segment
+ *
+ *  one segment of scattered write data for #usbiss_i2c_wrv and
+ *  #usbiss_i2c_wrv_rd, same layout as POSIX struct iovec
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_iovec {
+    const void* base;       /**<  segment data, can be NULL if len is zero */
+    size_t      len;        /**<  number of bytes in segment */
+} t_usbiss_iovec;
+
+
+
+/**
+ *  @typedef t_usbiss_i2c_route
+ *
+ *  @brief  device route
+ *
+ *  I2C device behind multiplexer channel, result of #usbiss_i2c_mux_scan
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_i2c_route {
+    uint8_t     uint8Mux;       /**<  Seven Bit I2C address of multiplexer, #USBISS_I2C_MUX_ROOT: root bus */
+    uint8_t     uint8Channel;   /**<  multiplexer channel */
+    uint8_t     uint8Adr7;      /**<  Seven Bit I2C address of device */
+} t_usbiss_i2c_route;
+
+
+
+/**
+ *  @typedef t_usbiss_i2c_qual
+ *
+ *  @brief  I2C mode qualification
+ *
+ *  pattern and results of I2C bus speed qualification, see #usbiss_i2c_qualify
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_i2c_qual {
+    /* pattern */
+    uint8_t     uint8Adr7;      /**<  Seven Bit I2C address */
+    void*       wr;             /**<  pattern write data, f.e. register address */
+    size_t      wrLen;          /**<  number of bytes to write */
+    size_t      rdLen;          /**<  number of bytes to read */
+    uint32_t    uint32Iter;     /**<  pattern repetitions per mode, 0: #USBISS_I2C_QUAL_ITER */
+    uint32_t    uint32Tol;      /**<  tolerated failed transfers per mode */
+    uint8_t     uint8Cmp;       /**<  1: read data needs to match reference of slowest mode, for static registers */
+    /* result */
+    struct {
+        uint8_t     uint8Mode;      /**<  I2C transfer mode */
+        uint32_t    uint32Xfer;     /**<  performed transfers */
+        uint32_t    uint32Nack;     /**<  transfers without slave acknowledge */
+        uint32_t    uint32Ero;      /**<  transfers with other errors or data mismatch */
+        uint32_t    uint32Us;       /**<  average transfer time in us */
+        uint32_t    uint32Bps;      /**<  payload throughput in byte/s */
+    } mode[USBISS_I2C_NUM_CLK];     /**<  result per I2C mode, from slowest to fastest */
+} t_usbiss_i2c_qual;
+
+
+
 /* C++ compatibility */
 #ifdef __cplusplus
 extern "C"
@@ -255,6 +524,25 @@ int usbiss_list_uart( char *uart, size_t len, const char sep[] );
 
 
 
+/**
+ *  @brief find UART port
+ *
+ *  finds UART port of USB-ISS by USB serial number. On Linux the USB
+ *  attributes are read from sysfs, no port is opened.
+ *
+ *  @param[in]      serial              USB serial number, f.e. 00060147
+ *  @param[out]     port                UART port, f.e. /dev/ttyACM0
+ *  @param[in]      len                 maximum string length of port
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_find_uart( const char* serial, char* port, size_t len );
+
+
+
 /**
  *  @brief init
  *
@@ -302,6 +590,43 @@ int usbiss_open( t_usbiss *self, char* port, uint32_t baud );
 
 
 
+/**
+ *  @brief open by serial
+ *
+ *  opens USB-ISS with given USB serial number, stable in multi adapter setups
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      serial              USB serial number, f.e. 00060147
+ *  @param[in]      baud                UART baudrate, 0 for default
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_open_serial( t_usbiss *self, const char* serial, uint32_t baud );
+
+
+
+/**
+ *  @brief handshake cache
+ *
+ *  sets file for caching the open handshake. Adapters listed with serial and
+ *  firmware skip ISS_VERSION and GET_SER_NUM on open, the transfer mode is then
+ *  unknown and the next #usbiss_set_mode is always sent. Call before #usbiss_open.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      path                cache file, NULL disables
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_set_cache( t_usbiss *self, const char* path );
+
+
+
 /**
  *  @brief close
  *
@@ -335,6 +660,197 @@ int usbiss_set_mode( t_usbiss *self, const char* mode );
 
 
 
+/**
+ *  @brief retry policy
+ *
+ *  set up retry and bus recovery policy of I2C read/write transfers.
+ *  Default is one attempt without retry.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      retry               retry policy
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+void usbiss_set_retry( t_usbiss *self, const t_usbiss_retry *retry );
+
+
+
+/**
+ *  @brief hotplug
+ *
+ *  reconnects the adapter after re-enumeration (USB glitch, hub reset). The
+ *  adapter is matched by USB serial number, transfer mode is restored. On Linux
+ *  device node events in /dev are watched, otherwise the adapter is searched
+ *  after a failed transfer. Transfers while the adapter is lost return
+ *  #USBISS_HOTPLUG_LOST and can be repeated after reconnect.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      enable              1: enable, 0: disable
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, adapter not open
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_hotplug_enable( t_usbiss *self, uint8_t enable );
+
+
+
+/**
+ *  @brief hotplug poll
+ *
+ *  processes pending device events and tries to reconnect a lost adapter,
+ *  non-blocking. Called by every I2C transfer, long idle applications call
+ *  it periodically.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @return         int
+ *  @retval         0                   adapter connected
+ *  @retval         -1                  FAIL, adapter not open
+ *  @retval         #USBISS_HOTPLUG_LOST    adapter lost, not yet reconnected
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_hotplug_poll( t_usbiss *self );
+
+
+
+/**
+ *  @brief re-sync
+ *
+ *  aligns the UART stream to the USB-ISS responses after a short or unexpected
+ *  response. Pending bytes are dropped until the line is quiet for
+ *  #USBISS_RESYNC_QUIET_US, afterwards an ISS_VERSION probe is sent and the
+ *  stream is aligned to its known 3 byte answer.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_resync( t_usbiss *self );
+
+
+
+/**
+ *  @brief I2C bus recovery
+ *
+ *  tries to free a clamped I2C bus and to re-sync the USB-ISS:
+ *    1) re-sync UART stream, #usbiss_resync
+ *    2) apply Stopbit
+ *    3) clock out a stuck slave with #USBISS_RECOVER_CLK NACKed read bytes
+ *    4) apply Stopbit
+ *    5) re-apply current transfer mode
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_recover( t_usbiss *self );
+
+
+
+/**
+ *  @brief I2C clock profile
+ *
+ *  registers an I2C transfer mode for a dedicated slave. Before each access
+ *  to this slave the driver switches the USB-ISS to the registered mode, but
+ *  only if the current mode differs. Slaves without profile are accessed
+ *  with the mode set by #usbiss_set_mode.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      mode                I2C transfer mode, f.e. "I2C_H_1000KHZ", NULL or "" removes the profile
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_set_clk( t_usbiss *self, uint8_t adr7, const char* mode );
+
+
+
+/**
+ *  @brief I2C clock of slave
+ *
+ *  transfer mode used for the next access to the slave, registered clock
+ *  profile or mode set by #usbiss_set_mode. Transfers of
+ *  #usbiss_i2c_xfer_batch with the same clock keep their order.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @return         uint8_t             USBISS transfer mode, #USBISS_MODE
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+uint8_t usbiss_i2c_get_clk( t_usbiss *self, uint8_t adr7 );
+
+
+
+/**
+ *  @brief I2C clock qualification
+ *
+ *  runs the pattern of qual at every supported I2C mode from slowest to
+ *  fastest and measures NACK and error count, transfer time and throughput.
+ *  The fastest mode with not more than qual->uint32Tol failed transfers is
+ *  selected. On success the mode is registered as I2C clock profile of the
+ *  slave, see #usbiss_i2c_set_clk.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in,out]  qual                pattern and result per mode
+ *  @return         int                 fastest reliable mode or error
+ *  @retval         >0                  fastest reliable I2C mode, #USBISS_MODE
+ *  @retval         -1                  FAIL, no reliable mode
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_qualify( t_usbiss *self, t_usbiss_i2c_qual *qual );
+
+
+
+/**
+ *  @brief save I2C clock profiles
+ *
+ *  stores all I2C clock profiles of the adapter in a text file. Profiles of
+ *  other adapters in the file, identified by the serial number, are kept.
+ *  Line format: '<serial> <adr7> <mode>'
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      path                file path
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_clk_save( t_usbiss *self, const char* path );
+
+
+
+/**
+ *  @brief load I2C clock profiles
+ *
+ *  registers the I2C clock profiles stored by #usbiss_i2c_clk_save for the
+ *  serial number of the open adapter
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      path                file path
+ *  @return         int                 number of loaded profiles or error
+ *  @retval         >=0                 loaded profiles
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_clk_load( t_usbiss *self, const char* path );
+
+
+
 /**
  *  @brief Scan I2C devices
  *
@@ -358,6 +874,27 @@ int usbiss_i2c_scan( t_usbiss *self, int8_t start, int8_t stop, int8_t* i2c, uin
 
 
 
+/**
+ *  @brief Test I2C device
+ *
+ *  checks for ACK of I2C address with the USB-ISS test command. The
+ *  tests are sent as one request and executed back-to-back by the
+ *  USB-ISS, f.e. ACK polling of EEPROM write cycle.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      num                 number of tests, max #USBISS_I2C_TEST_BURST
+ *  @return         int
+ *  @retval         0                   device acknowledged at least one test
+ *  @retval         -1                  FAIL
+ *  @retval         #USBISS_ERO_ID1     no ACK from device
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_test( t_usbiss *self, uint8_t adr7, uint8_t num );
+
+
+
 /**
  *  @brief i2c-write
  *
@@ -370,6 +907,7 @@ int usbiss_i2c_scan( t_usbiss *self, int8_t start, int8_t stop, int8_t* i2c, uin
  *  @return         int                 state
  *  @retval         0                   OK
  *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
  *  @since          July 7, 2023
  *  @author         Andreas Kaeberlein
  */
@@ -417,6 +955,387 @@ int usbiss_i2c_rd( t_usbiss *self, uint8_t adr7, void* data, size_t len );
 int usbiss_i2c_wr_rd( t_usbiss *self, uint8_t adr7, void* data, size_t wrLen, size_t rdLen );
 
 
+
+/**
+ *  @brief i2c-write scattered
+ *
+ *  writes segments as one I2C transfer, f.e. register address and payload
+ *  without joining them. The USB frames are filled straight from the
+ *  segments.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      iov                 write segments, sent in order
+ *  @param[in]      iovNum              number of segments
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_wrv( t_usbiss *self, uint8_t adr7, const t_usbiss_iovec *iov, size_t iovNum );
+
+
+
+/**
+ *  @brief i2c-write scattered and read
+ *
+ *  writes segments, sents repeated start for direction change and reads
+ *  from i2c device into a separate buffer. Without read data only the
+ *  write is performed.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      iov                 write segments, sent in order
+ *  @param[in]      iovNum              number of segments
+ *  @param[out]     rd                  read data
+ *  @param[in]      rdLen               number of requested bytes from slave
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_wrv_rd( t_usbiss *self, uint8_t adr7, const t_usbiss_iovec *iov, size_t iovNum, void* rd, size_t rdLen );
+
+
+
+/**
+ *  @brief i2c-transfer
+ *
+ *  performs one I2C transfer described by #t_usbiss_i2c_xfer. Depending on
+ *  the lengths a write, a read or a write followed by repeated start and read
+ *  is performed. Other than #usbiss_i2c_wr_rd the read data is stored in a
+ *  separate buffer.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in,out]  xfer                transfer description, result in xfer->intRet
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_xfer( t_usbiss *self, t_usbiss_i2c_xfer *xfer );
+
+
+
+/**
+ *  @brief i2c-transfer batch
+ *
+ *  performs a list of I2C transfers. The transfers are grouped by the I2C
+ *  clock profile of the addressed slave (#usbiss_i2c_set_clk), so that every
+ *  transfer mode is selected only once per batch. The order of the transfers
+ *  to one slave is preserved, transfers to different slaves can be reordered.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in,out]  xfer                array of transfers, results in xfer[i].intRet
+ *  @param[in]      num                 number of elements in xfer
+ *  @return         int                 state
+ *  @retval         0                   all transfers OK
+ *  @retval         -1                  at least one transfer failed
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_xfer_batch( t_usbiss *self, t_usbiss_i2c_xfer *xfer, size_t num );
+
+
+
+/**
+ *  @brief i2c-transfer pack
+ *
+ *  performs a list of short reads, f.e. register reads of many sensors, with
+ *  as few USB round trips as possible. Consecutive reads and write-reads with
+ *  at most #USBISS_I2C_CHUNK write and read bytes each are packed as complete
+ *  START...STOP transactions into one direct frame of at most
+ *  #USBISS_I2C_FRAME bytes, the combined response is split into the read
+ *  buffers. A frame only holds transfers of the same I2C clock profile
+ *  (#usbiss_i2c_set_clk).
+ *  The USB-ISS aborts a frame at the first not acknowledged byte without
+ *  telling the transaction, a rejected frame is therefore finished with a
+ *  stop bit and its transfers are repeated one by one by #usbiss_i2c_xfer,
+ *  which provides the state of every single slave. The transactions in
+ *  front of the aborting one are executed twice, slaves with read side
+ *  effects, f.e. clear on read flags or FIFOs, shall not be packed.
+ *  A slave failing the one by one transfer is excluded from packing and
+ *  transferred single until it acknowledges again, an absent slave costs
+ *  one rejected frame only.
+ *  Plain writes, longer transfers and transfers to slaves with register
+ *  cache are performed by #usbiss_i2c_xfer in list order.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in,out]  xfer                array of transfers, results in xfer[i].intRet
+ *  @param[in]      num                 number of elements in xfer
+ *  @return         int                 state
+ *  @retval         0                   all transfers OK
+ *  @retval         -1                  at least one transfer failed
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_xfer_pack( t_usbiss *self, t_usbiss_i2c_xfer *xfer, size_t num );
+
+
+
+/**
+ *  @brief i2c-multiplexer add
+ *
+ *  declares PCA954x multiplexer on root bus. The channel state is unknown
+ *  until the first select.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address of multiplexer
+ *  @param[in]      part                PCA9540, PCA9542, PCA9543, PCA9544, PCA9545, PCA9546 or PCA9548, NULL: PCA9548
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, unknown part or too many multiplexers
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_mux_add( t_usbiss *self, uint8_t adr7, const char* part );
+
+
+
+/**
+ *  @brief i2c-multiplexer select
+ *
+ *  enables one channel of the multiplexer, all other multiplexers are
+ *  disabled to avoid address conflicts. The selected channel is cached,
+ *  the select is only written if the channel changes. Transfers to the
+ *  multiplexer address by other functions invalidate the cache.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      mux                 Seven Bit I2C address of multiplexer
+ *  @param[in]      channel             channel, #USBISS_I2C_MUX_OFF disables all channels
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_mux_select( t_usbiss *self, uint8_t mux, uint8_t channel );
+
+
+
+/**
+ *  @brief i2c-multiplexer transfer
+ *
+ *  performs transfer to device behind multiplexer channel. Transfers up to
+ *  #USBISS_I2C_CHUNK write and read bytes are sent together with the
+ *  missing select writes in one direct frame, one USB round trip also if
+ *  the channel is already selected. If this frame is rejected the select
+ *  is written separately, so xfer->intRet tells the state of the device.
+ *  Longer transfers are performed after a separate select. The register
+ *  cache is kept per address, devices behind channels bypass it. Root bus
+ *  accesses disable all channels first and use the register cache.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      mux                 Seven Bit I2C address of multiplexer, #USBISS_I2C_MUX_ROOT: root bus
+ *  @param[in]      channel             multiplexer channel
+ *  @param[in,out]  xfer                transfer description, result in xfer->intRet
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_mux_xfer( t_usbiss *self, uint8_t mux, uint8_t channel, t_usbiss_i2c_xfer *xfer );
+
+
+
+/**
+ *  @brief i2c-multiplexer scan
+ *
+ *  scans root bus with all channels disabled and every channel of all
+ *  multiplexers, devices of the root bus are reported once. All channels
+ *  are disabled afterwards.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      start               first I2C address
+ *  @param[in]      stop                last I2C address
+ *  @param[out]     dev                 found devices
+ *  @param[in]      len                 number of elements in dev
+ *  @return         int                 state
+ *  @retval         >=0                 number of found devices
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_i2c_mux_scan( t_usbiss *self, int8_t start, int8_t stop, t_usbiss_i2c_route* dev, size_t len );
+
+
+
+/**
+ *  @brief register cache enable
+ *
+ *  enables register cache of I2C device, all registers are volatile. Register
+ *  writes by #usbiss_i2c_wr and #usbiss_i2c_xfer as well as register reads by
+ *  #usbiss_i2c_wr_rd and #usbiss_i2c_xfer are served by the cache according
+ *  the register attributes, see #usbiss_regcache_attr. Plain reads without
+ *  register address are always transferred. The caches are released by
+ *  #usbiss_close and invalidated after adapter reconnect.
+ *  Register writes can be buffered, see #usbiss_regcache_wrback.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      adrBytes            number of register address bytes, 1 or 2
+ *  @param[in]      num                 number of registers, starting at register 0
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_regcache_enable( t_usbiss *self, uint8_t adr7, uint8_t adrBytes, uint32_t num );
+
+
+
+/**
+ *  @brief register cache disable
+ *
+ *  writes buffered registers and releases register cache of I2C device
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address, #USBISS_REGCACHE_ALL for all devices
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+void usbiss_regcache_disable( t_usbiss *self, uint8_t adr7 );
+
+
+
+/**
+ *  @brief register attribute
+ *
+ *  sets attribute of register range and invalidates the cached values
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      reg                 first register
+ *  @param[in]      num                 number of registers
+ *  @param[in]      attr                register attribute, #USBISS_REGCACHE
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, f.e. cache not enabled or range exceeded
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_regcache_attr( t_usbiss *self, uint8_t adr7, uint32_t reg, uint32_t num, uint8_t attr );
+
+
+
+/**
+ *  @brief register cache invalidate
+ *
+ *  marks cached values as unknown, next read is transferred, f.e. after
+ *  device reset. Buffered writes stay valid until flushed.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address, #USBISS_REGCACHE_ALL for all devices
+ *  @param[in]      reg                 first register
+ *  @param[in]      num                 number of registers, 0: all registers
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, f.e. cache not enabled
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_regcache_invalidate( t_usbiss *self, uint8_t adr7, uint32_t reg, uint32_t num );
+
+
+
+/**
+ *  @brief register cache write-back
+ *
+ *  buffers register writes of non-volatile registers in the cache instead of
+ *  transferring them. Buffered registers are written at flush: adjacent or
+ *  overlapping ranges are merged into one auto-increment burst of up to
+ *  #USBISS_REGCACHE_BURST bytes, gaps of cached registers are only bridged
+ *  if enabled by #usbiss_regcache_gap, every burst is one direct frame. The I2C slave is flushed
+ *  before every transferred access, by #usbiss_regcache_flush, by
+ *  #usbiss_close and when the deadline is expired. The deadline is checked
+ *  on every I2C transfer of the adapter, idle applications call
+ *  #usbiss_regcache_poll. Registers of a failed deadline flush are
+ *  invalidated, the error is reported by the next #usbiss_regcache_poll or
+ *  #usbiss_regcache_flush.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      enable              1: buffer writes, 0: write through, flushes buffered registers
+ *  @param[in]      deadlineUs          buffered writes are flushed after this time, 0: only by flush
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, f.e. cache not enabled
+ *  @retval         >0                  USB-ISS error code of flush, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_regcache_wrback( t_usbiss *self, uint8_t adr7, uint8_t enable, uint32_t deadlineUs );
+
+
+
+/**
+ *  @brief register cache gap
+ *
+ *  allows bridging gaps of up to gap cached registers between buffered
+ *  writes at flush, the registers in between are rewritten with their
+ *  cached values. Only for registers without write side effects, f.e. no
+ *  command, FIFO or clear on write registers.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      gap                 bridged cached registers, max #USBISS_REGCACHE_GAP, 0: only adjacent
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, f.e. cache not enabled
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_regcache_gap( t_usbiss *self, uint8_t adr7, uint8_t gap );
+
+
+
+/**
+ *  @brief register cache flush
+ *
+ *  barrier, writes buffered registers. Also reports a failed deadline
+ *  flush since last #usbiss_regcache_poll or #usbiss_regcache_flush.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      adr7                Seven Bit I2C address, #USBISS_REGCACHE_ALL for all devices
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_regcache_flush( t_usbiss *self, uint8_t adr7 );
+
+
+
+/**
+ *  @brief register cache poll
+ *
+ *  flushes I2C slaves with expired write-back deadline, non-blocking.
+ *  Timer driven applications call it after sleepUs expired.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[out]     sleepUs             time until next deadline, UINT32_MAX: no deadline pending, can be NULL
+ *  @return         int                 state
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code of first failed deadline flush since last report, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_regcache_poll( t_usbiss *self, uint32_t *sleepUs );
+
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
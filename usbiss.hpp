@@ -0,0 +1,296 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss.hpp
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS C++ wrapper
+                  header-only C++20 layer of the USB-ISS driver:
+                    * RAII adapter handle, move only
+                    * separate write and read spans
+                    * std::expected style results
+                    * no heap allocation on transfer path
+***********************************************************************/
+
+
+
+// Define Guard
+#ifndef __USB_ISS_HPP
+#define __USB_ISS_HPP
+
+
+/** Includes **/
+#include <cstddef>      // std::byte
+#include <cstdint>      // fixed data types
+#include <new>          // placement new
+#include <span>         // std::span
+#include <utility>      // std::move
+#if __has_include(<expected>)
+    #include <expected> // std::expected
+#endif
+#include "usbiss.h"     // USBISS driver
+
+
+
+namespace usbiss {
+
+
+
+/**
+ *  @brief  error
+ *
+ *  driver result unequal zero
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+struct Error {
+    int code;   /**< -1: driver failure, >0: USB-ISS error code #USBISS_ERROR, #USBISS_HOTPLUG_LOST */
+
+    /** human readable error */
+    const char* what() const noexcept
+    {
+        if ( USBISS_HOTPLUG_LOST == code ) {
+            return "Adapter lost";
+        }
+        return (0 < code) ? usbiss_ero_str(static_cast<uint8_t>(code)) : "Driver failure";
+    }
+};
+
+
+
+#if defined(__cpp_lib_expected) && (__cpp_lib_expected >= 202202L)
+/** result or #Error */
+template <class T>
+using Expected = std::expected<T, Error>;
+
+/** error result */
+inline std::unexpected<Error> unexpected( int code ) noexcept
+{
+    return std::unexpected<Error>(Error{code});
+}
+#else
+/**
+ *  @brief  unexpected
+ *
+ *  error carrier, converts into any #Expected
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+struct Unexpected {
+    Error   err;    /**< error */
+};
+
+/** error result */
+inline Unexpected unexpected( int code ) noexcept
+{
+    return Unexpected{Error{code}};
+}
+
+/**
+ *  @brief  expected
+ *
+ *  subset of C++23 std::expected for older standard libraries
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+template <class T>
+class Expected {
+public:
+    Expected( T&& val ) : m_ok(true), m_val(std::move(val)) {}
+    Expected( Unexpected u ) noexcept : m_ok(false), m_err(u.err) {}
+    Expected( Expected&& other ) : m_ok(other.m_ok)
+    {
+        if ( m_ok ) {   // only active member
+            new (&m_val) T(std::move(other.m_val));
+        } else {
+            new (&m_err) Error(other.m_err);
+        }
+    }
+    Expected( const Expected& ) = delete;
+    Expected& operator=( const Expected& ) = delete;
+    ~Expected()
+    {
+        if ( m_ok ) {
+            m_val.~T();
+        }
+    }
+    bool has_value() const noexcept { return m_ok; }
+    explicit operator bool() const noexcept { return m_ok; }
+    T& value() & noexcept { return m_val; }
+    T&& value() && noexcept { return std::move(m_val); }
+    T& operator*() & noexcept { return m_val; }
+    T* operator->() noexcept { return &m_val; }
+    const Error& error() const noexcept { return m_err; }
+private:
+    bool    m_ok;           /**< value valid */
+    union {
+        Error   m_err;      /**< error if not m_ok */
+        T       m_val;      /**< value if m_ok */
+    };
+};
+
+/** result without value */
+template <>
+class Expected<void> {
+public:
+    Expected() noexcept : m_ok(true), m_err{0} {}
+    Expected( Unexpected u ) noexcept : m_ok(false), m_err(u.err) {}
+    bool has_value() const noexcept { return m_ok; }
+    explicit operator bool() const noexcept { return m_ok; }
+    void value() const noexcept {}
+    const Error& error() const noexcept { return m_err; }
+private:
+    bool    m_ok;           /**< success */
+    Error   m_err;          /**< error if not m_ok */
+};
+#endif
+
+
+
+/**
+ *  @brief  result of driver call
+ *
+ *  @param[in]      intRet              driver return code
+ *  @return         Expected<void>      success or error
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+inline Expected<void> check( int intRet ) noexcept
+{
+    if ( 0 != intRet ) {
+        return unexpected(intRet);
+    }
+    return {};
+}
+
+
+
+/**
+ *  @brief  adapter
+ *
+ *  owns one opened USB-ISS, closed on destruction. Transfers take separate
+ *  write and read spans and use the C driver directly, the write data is
+ *  never modified.
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+class Adapter {
+public:
+    /** opens adapter at UART port, baud 0 selects default */
+    static Expected<Adapter> open( const char* port, uint32_t baud = 0 )
+    {
+        if ( nullptr == port ) {
+            return unexpected(-1);
+        }
+        Adapter adapter;
+        int intRet = usbiss_open(&adapter.m_usbiss, const_cast<char*>(port), baud);
+        if ( 0 != intRet ) {
+            return unexpected(intRet);
+        }
+        return adapter;
+    }
+
+    /** opens adapter by USB serial number, baud 0 selects default */
+    static Expected<Adapter> open_serial( const char* serial, uint32_t baud = 0 )
+    {
+        if ( nullptr == serial ) {
+            return unexpected(-1);
+        }
+        Adapter adapter;
+        int intRet = usbiss_open_serial(&adapter.m_usbiss, serial, baud);
+        if ( 0 != intRet ) {
+            return unexpected(intRet);
+        }
+        return adapter;
+    }
+
+    Adapter( const Adapter& ) = delete;
+    Adapter& operator=( const Adapter& ) = delete;
+
+    Adapter( Adapter&& other ) noexcept : m_usbiss(other.m_usbiss)
+    {
+        usbiss_init(&other.m_usbiss);   // ownership moved, source has nothing to close
+    }
+
+    Adapter& operator=( Adapter&& other ) noexcept
+    {
+        if ( this != &other ) {
+            usbiss_close(&m_usbiss);
+            m_usbiss = other.m_usbiss;
+            usbiss_init(&other.m_usbiss);
+        }
+        return *this;
+    }
+
+    ~Adapter()
+    {
+        usbiss_close(&m_usbiss);
+    }
+
+    /** I2C transfer mode, f.e. "I2C_S_100KHZ" */
+    Expected<void> set_mode( const char* mode ) noexcept
+    {
+        return check(usbiss_set_mode(&m_usbiss, mode));
+    }
+
+    /** I2C write */
+    Expected<void> write( uint8_t adr7, std::span<const std::byte> wr ) noexcept
+    {
+        return write_read(adr7, wr, {});
+    }
+
+    /** I2C read */
+    Expected<void> read( uint8_t adr7, std::span<std::byte> rd ) noexcept
+    {
+        return write_read(adr7, {}, rd);
+    }
+
+    /** I2C write, repeated start and read, write data is kept */
+    Expected<void> write_read( uint8_t adr7, std::span<const std::byte> wr, std::span<std::byte> rd ) noexcept
+    {
+        t_usbiss_i2c_xfer xfer = {adr7, const_cast<std::byte*>(wr.data()), wr.size(), rd.data(), rd.size(), 0};
+        return check(usbiss_i2c_xfer(&m_usbiss, &xfer));
+    }
+
+    /** I2C address acknowledged */
+    Expected<bool> test( uint8_t adr7, uint8_t num = 1 ) noexcept
+    {
+        int intRet = usbiss_i2c_test(&m_usbiss, adr7, num);
+        if ( (0 != intRet) && (USBISS_ERO_ID1 != intRet) ) {
+            return unexpected(intRet);
+        }
+        return 0 == intRet;
+    }
+
+    /** C handle for other driver functions, f.e. #usbiss_regcache_enable */
+    t_usbiss* native() noexcept
+    {
+        return &m_usbiss;
+    }
+
+private:
+    Adapter() noexcept
+    {
+        usbiss_init(&m_usbiss);
+    }
+
+    t_usbiss    m_usbiss;   /**< C driver handle */
+};
+
+
+}   // namespace usbiss
+
+
+#endif // __USB_ISS_HPP
@@ -0,0 +1,407 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_coro.hpp
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS coroutines
+                  header-only C++20 coroutine layer on usbiss.hpp,
+                  Linux only:
+                    * co_await on bus transfers
+                    * epoll based single thread executor
+                    * one I/O thread per shared adapter
+                    * transfers of waiting coroutines served in order
+***********************************************************************/
+
+
+
+// Define Guard
+#ifndef __USB_ISS_CORO_HPP
+#define __USB_ISS_CORO_HPP
+
+
+/** Includes **/
+#include <cerrno>           // errno
+#include <condition_variable>   // std::condition_variable
+#include <coroutine>        // std::coroutine_handle
+#include <cstddef>          // size_t
+#include <cstdint>          // fixed data types
+#include <deque>            // std::deque
+#include <exception>        // std::terminate
+#include <mutex>            // std::mutex
+#include <span>             // std::span
+#include <thread>           // std::thread
+#include <vector>           // std::vector
+#include <sys/epoll.h>      // epoll_create1
+#include <sys/eventfd.h>    // eventfd
+#include <unistd.h>         // close
+#include "usbiss.hpp"       // USBISS C++ wrapper
+
+
+
+namespace usbiss {
+namespace coro {
+
+
+
+class Executor;
+
+
+
+/**
+ *  @brief  task
+ *
+ *  coroutine started by #Executor::spawn, frame is released when the
+ *  coroutine returns
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+class Task {
+public:
+    struct promise_type {
+        Executor*   m_exec = nullptr;   /**< executor counting the task */
+
+        Task get_return_object() noexcept
+        {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+        inline ~promise_type();
+    };
+
+    Task( Task&& other ) noexcept : m_handle(other.m_handle)
+    {
+        other.m_handle = nullptr;
+    }
+    Task( const Task& ) = delete;
+    Task& operator=( const Task& ) = delete;
+    Task& operator=( Task&& ) = delete;
+
+    ~Task()
+    {
+        if ( m_handle ) {   // never spawned
+            m_handle.destroy();
+        }
+    }
+
+private:
+    friend class Executor;
+    explicit Task( std::coroutine_handle<promise_type> handle ) noexcept : m_handle(handle) {}
+
+    std::coroutine_handle<promise_type> m_handle;   /**< suspended coroutine */
+};
+
+
+
+/**
+ *  @brief  executor
+ *
+ *  resumes coroutines on the thread calling #run. Completions of other
+ *  threads are queued and signalled by an eventfd, the executor sleeps in
+ *  epoll_wait until then. fd() can be added to a foreign epoll loop,
+ *  which calls run_once(0) when readable.
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+class Executor {
+public:
+    Executor() noexcept
+    {
+        struct epoll_event ev = {};
+        m_epfd = epoll_create1(EPOLL_CLOEXEC);
+        m_evfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        ev.events = EPOLLIN;
+        ev.data.fd = m_evfd;
+        if ( (0 > m_epfd) || (0 > m_evfd) || (0 != epoll_ctl(m_epfd, EPOLL_CTL_ADD, m_evfd, &ev)) ) {
+            m_valid = false;
+        }
+    }
+
+    Executor( const Executor& ) = delete;
+    Executor& operator=( const Executor& ) = delete;
+
+    ~Executor()
+    {
+        if ( 0 <= m_evfd ) {
+            close(m_evfd);
+        }
+        if ( 0 <= m_epfd ) {
+            close(m_epfd);
+        }
+    }
+
+    /** epoll and eventfd created */
+    bool valid() const noexcept
+    {
+        return m_valid;
+    }
+
+    /** epoll descriptor, readable if coroutines are ready */
+    int fd() const noexcept
+    {
+        return m_epfd;
+    }
+
+    /** number of unfinished tasks */
+    size_t pending() const noexcept
+    {
+        return m_live;
+    }
+
+    /** starts task with next run_once */
+    void spawn( Task task )
+    {
+        task.m_handle.promise().m_exec = this;
+        ++m_live;
+        post(task.m_handle);
+        task.m_handle = nullptr;
+    }
+
+    /** queues coroutine for resume, thread safe */
+    void post( std::coroutine_handle<> handle )
+    {
+        const uint64_t uint64One = 1;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_ready.push_back(handle);
+        }
+        if ( 0 > ::write(m_evfd, &uint64One, sizeof(uint64One)) ) {
+            // EAGAIN: counter saturated, executor wakes up anyway
+        }
+    }
+
+    /**
+     *  @brief  run once
+     *
+     *  waits for ready coroutines and resumes them
+     *
+     *  @param[in]      tmoMs               epoll_wait timeout, -1: infinite
+     *  @return         int                 number of resumed coroutines, -1: epoll failed
+     */
+    int run_once( int tmoMs = -1 )
+    {
+        struct epoll_event ev;
+        uint64_t uint64Cnt;
+        std::deque<std::coroutine_handle<>> ready;
+        int intNum = epoll_wait(m_epfd, &ev, 1, tmoMs);
+        if ( 0 > intNum ) {
+            return (EINTR == errno) ? 0 : -1;
+        }
+        if ( 0 == intNum ) {
+            return 0;
+        }
+        if ( 0 > ::read(m_evfd, &uint64Cnt, sizeof(uint64Cnt)) ) {
+            // EAGAIN: already consumed, queue is checked anyway
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ready.swap(m_ready);
+        }
+        for ( std::coroutine_handle<> handle : ready ) {
+            handle.resume();
+        }
+        return static_cast<int>(ready.size());
+    }
+
+    /**
+     *  @brief  run
+     *
+     *  resumes coroutines until all spawned tasks returned
+     *
+     *  @return         int                 0: OK, -1: epoll failed
+     */
+    int run()
+    {
+        if ( !m_valid ) {
+            return -1;
+        }
+        while ( 0 != m_live ) {
+            if ( 0 > run_once(-1) ) {
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+private:
+    friend struct Task::promise_type;
+
+    int                                 m_epfd = -1;        /**< epoll instance */
+    int                                 m_evfd = -1;        /**< wake up of epoll_wait */
+    bool                                m_valid = true;     /**< descriptors created */
+    size_t                              m_live = 0;         /**< unfinished tasks */
+    std::mutex                          m_mutex;            /**< protects m_ready */
+    std::deque<std::coroutine_handle<>> m_ready;            /**< coroutines to resume */
+};
+
+
+/** task returned, executor stops if last */
+inline Task::promise_type::~promise_type()
+{
+    if ( nullptr != m_exec ) {
+        --m_exec->m_live;
+    }
+}
+
+
+
+/**
+ *  @brief  bus
+ *
+ *  shares one adapter between many coroutines. A transfer suspends the
+ *  coroutine until the I/O thread completed it, the coroutine is resumed
+ *  by the executor. Waiting transfers are served in arrival order, a
+ *  coroutine issuing its next transfer queues behind all others. The I/O
+ *  thread takes up to #BATCH waiting transfers at once and performs them
+ *  with #usbiss_i2c_xfer_batch, which avoids mode switches between slaves
+ *  of different clock profiles.
+ *
+ *  While the bus exists the adapter is used only by its I/O thread.
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+class Bus {
+public:
+    static constexpr size_t BATCH = 16;     /**< maximum transfers per I/O thread wake up */
+
+    /**
+     *  @brief  transfer awaitable
+     *
+     *  result of co_await is Expected<void>
+     */
+    class Op {
+    public:
+        bool await_ready() const noexcept { return false; }
+        void await_suspend( std::coroutine_handle<> handle )
+        {
+            m_handle = handle;
+            m_bus->submit(this);
+        }
+        Expected<void> await_resume() const noexcept
+        {
+            return check(m_xfer.intRet);
+        }
+
+    private:
+        friend class Bus;
+        Op( Bus* bus, uint8_t adr7, std::span<const std::byte> wr, std::span<std::byte> rd ) noexcept
+            : m_bus(bus), m_xfer{adr7, const_cast<std::byte*>(wr.data()), wr.size(), rd.data(), rd.size(), 0} {}
+
+        Bus*                    m_bus;      /**< owning bus */
+        t_usbiss_i2c_xfer       m_xfer;     /**< transfer, result in intRet */
+        std::coroutine_handle<> m_handle;   /**< waiting coroutine */
+    };
+
+    /** starts I/O thread of adapter */
+    Bus( Executor& exec, Adapter& adapter ) : m_exec(exec), m_adapter(adapter), m_thread([this] { worker(); }) {}
+
+    Bus( const Bus& ) = delete;
+    Bus& operator=( const Bus& ) = delete;
+
+    /** waits until queued transfers are done and stops I/O thread */
+    ~Bus()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cond.notify_one();
+        m_thread.join();
+    }
+
+    /** I2C write */
+    Op write( uint8_t adr7, std::span<const std::byte> wr ) noexcept
+    {
+        return Op(this, adr7, wr, {});
+    }
+
+    /** I2C read */
+    Op read( uint8_t adr7, std::span<std::byte> rd ) noexcept
+    {
+        return Op(this, adr7, {}, rd);
+    }
+
+    /** I2C write, repeated start and read, write data is kept */
+    Op write_read( uint8_t adr7, std::span<const std::byte> wr, std::span<std::byte> rd ) noexcept
+    {
+        return Op(this, adr7, wr, rd);
+    }
+
+private:
+    /** queues transfer for I/O thread */
+    void submit( Op* op )
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push_back(op);
+        }
+        m_cond.notify_one();
+    }
+
+    /** I/O thread, performs queued transfers */
+    void worker()
+    {
+        std::vector<Op*> ops;
+        std::vector<t_usbiss_i2c_xfer> xfer;
+        ops.reserve(BATCH);
+        xfer.reserve(BATCH);
+        for ( ;; ) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cond.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+                if ( m_queue.empty() ) {
+                    return;     // stop requested and drained
+                }
+                ops.clear();
+                while ( !m_queue.empty() && (ops.size() < BATCH) ) {
+                    ops.push_back(m_queue.front());
+                    m_queue.pop_front();
+                }
+            }
+            if ( 1 == ops.size() ) {
+                usbiss_i2c_xfer(m_adapter.native(), &ops[0]->m_xfer);
+            } else {
+                xfer.clear();
+                for ( Op* op : ops ) {
+                    xfer.push_back(op->m_xfer);
+                }
+                usbiss_i2c_xfer_batch(m_adapter.native(), xfer.data(), xfer.size());
+                for ( size_t i = 0; i < ops.size(); i++ ) {
+                    ops[i]->m_xfer.intRet = xfer[i].intRet;
+                }
+            }
+            for ( Op* op : ops ) {
+                m_exec.post(op->m_handle);
+            }
+        }
+    }
+
+    Executor&               m_exec;             /**< resumes finished coroutines */
+    Adapter&                m_adapter;          /**< shared adapter */
+    std::mutex              m_mutex;            /**< protects m_queue and m_stop */
+    std::condition_variable m_cond;             /**< wakes I/O thread */
+    std::deque<Op*>         m_queue;            /**< waiting transfers in arrival order */
+    bool                    m_stop = false;     /**< I/O thread terminates when drained */
+    std::thread             m_thread;           /**< I/O thread, last member, starts after init of others */
+};
+
+
+}   // namespace coro
+}   // namespace usbiss
+
+
+#endif // __USB_ISS_CORO_HPP
@@ -0,0 +1,855 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_eeprom.c
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS serial EEPROM access
+                  24Cxx style I2C EEPROMs:
+                    * sequential read in large chunks
+                    * page write split on page boundaries
+                    * ACK polling of write cycle
+                    * part table with page sizes
+                    * interleaved programming of several EEPROMs
+                    * differential programming of changed pages
+                    * streamed read back with CRC32C
+***********************************************************************/
+
+
+
+/** Includes **/
+/* Standard libs */
+#include <stdio.h>      // f.e. printf
+#include <stdint.h>     // defines fixed data types, like int8_t...
+#include <string.h>     // memcpy
+#include <stdlib.h>     // strtoul
+#include <ctype.h>      // isdigit
+#if defined(_WIN32)
+    #include <windows.h>    // QueryPerformanceCounter
+#else
+    #include <time.h>       // clock_gettime
+    #include <pthread.h>    // stream reader thread
+#endif
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>   // CRC32C instructions
+#endif
+/** self **/
+#include "usbiss.h"         // USBISS driver
+#include "usbiss_eeprom.h"  // some defs
+
+
+
+/**
+ *  @brief EEPROM parts
+ *
+ *  24Cxx geometry by density, page size is the smallest of common vendors
+ *
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static const t_usbiss_eeprom_part g_usbiss_eeprom_part[] = {
+    {    1, 1,   8 },   // 24C01
+    {    2, 1,   8 },   // 24C02
+    {    4, 1,  16 },   // 24C04
+    {    8, 1,  16 },   // 24C08
+    {   16, 1,  16 },   // 24C16
+    {   32, 2,  32 },   // 24C32
+    {   64, 2,  32 },   // 24C64
+    {  128, 2,  64 },   // 24C128
+    {  256, 2,  64 },   // 24C256
+    {  512, 2, 128 },   // 24C512
+    { 1024, 2, 256 },   // 24M01
+    { 2048, 2, 256 }    // 24M02
+};
+
+
+
+/**
+ *  @brief CRC32C table
+ *
+ *  reflected polynomial 0x82f63b78, precomputed, shared by stream threads
+ *
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static const uint32_t g_usbiss_crc32c_tab[256] = {
+    0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
+    0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24,
+    0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+    0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc, 0xbc267848, 0x4e4dfb4b,
+    0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+    0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+    0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59, 0xe4292d5a,
+    0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a, 0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595,
+    0x417b1dbc, 0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+    0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+    0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38,
+    0xdbfc821c, 0x2997011f, 0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+    0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789,
+    0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46,
+    0x7198540d, 0x83f3d70e, 0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+    0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de, 0xdde0eb2a, 0x2f8b6829,
+    0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93,
+    0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+    0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b, 0xb4091bff, 0x466298fc,
+    0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+    0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+    0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81, 0xfc588982,
+    0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d, 0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622,
+    0x38cc2a06, 0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+    0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+    0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0,
+    0xd3d3e1ab, 0x21b862a8, 0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+    0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f,
+    0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1,
+    0x69e9f0d5, 0x9b8273d6, 0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+    0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69, 0xd5cf889d, 0x27a40b9e,
+    0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351
+};
+
+
+
+#if !defined(_WIN32)
+/**
+ *  @typedef t_usbiss_eeprom_rdr
+ *
+ *  @brief  stream reader, double buffer shared between reader thread and sink
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_eeprom_rdr {
+    t_usbiss_eeprom*    self;                               /**<  EEPROM handle */
+    uint32_t            ofs;                                /**<  memory offset */
+    size_t              len;                                /**<  number of bytes */
+    uint8_t             buf[2][USBISS_EEPROM_RD_CHUNK];     /**<  chunk buffers */
+    size_t              num[2];                             /**<  bytes in buffer */
+    uint8_t             full[2];                            /**<  buffer filled by reader */
+    uint8_t             stop;                               /**<  sink requests stop */
+    int                 intRet[2];                          /**<  read result of buffer */
+    pthread_mutex_t     mtx;                                /**<  protects flags */
+    pthread_cond_t      cond;                               /**<  flag change */
+} t_usbiss_eeprom_rdr;
+#endif
+
+
+
+/**
+ *  @brief monotonic time
+ *
+ *  @return         uint64_t            time in us
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint64_t usbiss_eeprom_time_us( void )
+{
+#if defined(_WIN32)
+    LARGE_INTEGER   cnt, frq;
+    QueryPerformanceCounter(&cnt);
+    QueryPerformanceFrequency(&frq);
+    return (uint64_t) ((cnt.QuadPart / frq.QuadPart) * 1000000 + ((cnt.QuadPart % frq.QuadPart) * 1000000) / frq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) ts.tv_nsec / 1000;
+#endif
+}
+
+
+
+/**
+ *  @brief write cycle
+ *
+ *  EEPROM does not acknowledge its address during internal write cycle,
+ *  polls with address tests until ACK or timeout
+ *
+ *  @param[in,out]  self                EEPROM handle
+ *  @param[in]      adr7                I2C address of written block
+ *  @return         int
+ *  @retval         0                   OK, write cycle finished
+ *  @retval         -1                  FAIL
+ *  @retval         #USBISS_ERO_ID1     timeout
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_eeprom_wr_cycle( t_usbiss_eeprom *self, uint8_t adr7 )
+{
+    /** Variables **/
+    uint64_t    uint64Tmo = usbiss_eeprom_time_us() + self->uint32WrCycleUs;    // give up
+    int         intRet;                                                         // test result
+
+    do {
+        intRet = usbiss_i2c_test(self->usbiss, adr7, USBISS_EEPROM_POLL_NUM);
+        self->uint32Polls += USBISS_EEPROM_POLL_NUM;
+        if ( USBISS_ERO_ID1 != intRet ) {
+            return intRet;
+        }
+    } while ( usbiss_eeprom_time_us() < uint64Tmo );
+    if ( 0 != self->usbiss->uint8MsgLevel ) {
+        printf("  ERROR:%s: write cycle of adr=0x%02x not finished after %u us\n", __FUNCTION__, adr7, self->uint32WrCycleUs);
+    }
+    return USBISS_ERO_ID1;
+}
+
+
+
+/**
+ *  @brief address
+ *
+ *  splits memory offset into I2C address with block select bits and word address
+ *
+ *  @param[in]      self                EEPROM handle
+ *  @param[in]      ofs                 memory offset
+ *  @param[out]     adr7                I2C address of block
+ *  @param[out]     word                word address, MSB first
+ *  @return         uint32_t            remaining bytes until block end
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint32_t usbiss_eeprom_adr( const t_usbiss_eeprom *self, uint32_t ofs, uint8_t *adr7, uint8_t *word )
+{
+    /** Variables **/
+    uint8_t     uint8Shift = (uint8_t) (8 * self->uint8AdrBytes);   // word address width
+
+    *adr7 = (uint8_t) (self->uint8Adr7 | ((ofs >> uint8Shift) & 0x07));
+    for ( uint8_t i = 0; i < self->uint8AdrBytes; i++ ) {
+        word[i] = (uint8_t) (ofs >> (8 * (self->uint8AdrBytes - 1 - i)));
+    }
+    return (uint32_t) ((1UL << uint8Shift) - (ofs & ((1UL << uint8Shift) - 1)));
+}
+
+
+
+/**
+ *  usbiss_eeprom_init
+ *    initializes EEPROM description
+ */
+int usbiss_eeprom_init( t_usbiss_eeprom *self, t_usbiss *usbiss, uint8_t adr7, uint8_t adrBytes, uint16_t pageSize )
+{
+    /* check args */
+    if ( (NULL == self) || (NULL == usbiss) || (adr7 > 0x7f) || (0 == adrBytes) || (2 < adrBytes) || (0 == pageSize) || (USBISS_EEPROM_PAGE_MAX < pageSize) ) {
+        return -1;
+    }
+    self->usbiss = usbiss;
+    self->uint8Adr7 = adr7;
+    self->uint8AdrBytes = adrBytes;
+    self->uint16PageSize = pageSize;
+    self->uint32Size = 0;
+    self->uint32WrCycleUs = USBISS_EEPROM_TMO_US;
+    self->uint32Polls = 0;
+    self->uint32PageWr = 0;
+    self->uint32PageSkip = 0;
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_eeprom_init_part
+ *    initializes EEPROM description from part table
+ */
+int usbiss_eeprom_init_part( t_usbiss_eeprom *self, t_usbiss *usbiss, uint8_t adr7, const char* part )
+{
+    /** Variables **/
+    const char* charPtrDens;    // density in part name
+    uint32_t    uint32Kbit;     // density
+    uint8_t     uint8Mbit = 0;  // density in Mbit, f.e. 24M01
+
+    /* density follows family '24' and technology letters, f.e. AT24C256, 24LC64, M24M01 */
+    if ( NULL == part ) {
+        return -1;
+    }
+    charPtrDens = strstr(part, "24");
+    if ( NULL == charPtrDens ) {
+        return -1;
+    }
+    charPtrDens += 2;
+    while ( ('\0' != *charPtrDens) && !isdigit((unsigned char) *charPtrDens) ) {
+        uint8Mbit = (('M' == *charPtrDens) || ('m' == *charPtrDens)) ? 1 : 0;
+        ++charPtrDens;
+    }
+    if ( '\0' == *charPtrDens ) {
+        return -1;
+    }
+    uint32Kbit = (uint32_t) strtoul(charPtrDens, NULL, 10) * ((0 != uint8Mbit) ? 1024 : 1);
+    /* part table */
+    for ( size_t i = 0; i < sizeof(g_usbiss_eeprom_part)/sizeof(g_usbiss_eeprom_part[0]); i++ ) {
+        if ( uint32Kbit == g_usbiss_eeprom_part[i].uint16Kbit ) {
+            if ( 0 != usbiss_eeprom_init(self, usbiss, adr7, g_usbiss_eeprom_part[i].uint8AdrBytes, g_usbiss_eeprom_part[i].uint16PageSize) ) {
+                return -1;
+            }
+            self->uint32Size = uint32Kbit * 128;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+
+
+/**
+ *  usbiss_eeprom_rd
+ *    reads memory range in large chunks
+ */
+int usbiss_eeprom_rd( t_usbiss_eeprom *self, uint32_t ofs, void* data, size_t len )
+{
+    /** Variables **/
+    t_usbiss_i2c_xfer   xfer;       // sequential read
+    uint8_t             word[2];    // word address
+    size_t              done = 0;   // read bytes
+
+    /* Function Call Message */
+    if ( 0 != self->usbiss->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* memory range */
+    if ( (0 != self->uint32Size) && ((uint64_t) ofs + len > self->uint32Size) ) {
+        if ( 0 != self->usbiss->uint8MsgLevel ) {
+            printf("  ERROR:%s: ofs=0x%x len=%zu exceeds size %u\n", __FUNCTION__, ofs, len, self->uint32Size);
+        }
+        return -1;
+    }
+    /* random read of first byte, followed by sequential read until chunk or block end */
+    xfer.wr = word;
+    xfer.wrLen = self->uint8AdrBytes;
+    while ( done < len ) {
+        xfer.rdLen = usbiss_min(len - done, (size_t) usbiss_eeprom_adr(self, ofs + (uint32_t) done, &xfer.uint8Adr7, word));
+        xfer.rdLen = usbiss_min(xfer.rdLen, (size_t) USBISS_EEPROM_RD_CHUNK);
+        xfer.rd = (uint8_t*) data + done;
+        if ( 0 != usbiss_i2c_xfer(self->usbiss, &xfer) ) {
+            if ( 0 != self->usbiss->uint8MsgLevel ) {
+                printf("  ERROR:%s: read adr=0x%02x ofs=0x%x ero=%i\n", __FUNCTION__, xfer.uint8Adr7, ofs + (uint32_t) done, xfer.intRet);
+            }
+            return xfer.intRet;
+        }
+        done += xfer.rdLen;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief page write
+ *
+ *  writes data up to next page boundary, write cycle is not awaited
+ *
+ *  @param[in,out]  self                EEPROM handle
+ *  @param[in]      ofs                 memory offset
+ *  @param[in]      data                write data
+ *  @param[in]      len                 number of available bytes in data
+ *  @param[out]     adr7                I2C address of written block, for ACK polling
+ *  @param[out]     num                 number of written bytes
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_eeprom_wr_page( t_usbiss_eeprom *self, uint32_t ofs, const void* data, size_t len, uint8_t *adr7, size_t *num )
+{
+    /** Variables **/
+    uint8_t         uint8Adr[2];    // word address
+    t_usbiss_iovec  iov[2];         // word address and page data, no copy
+    int             intRet;         // transfer result
+
+    /* page write wraps at page end, split on page boundary */
+    usbiss_eeprom_adr(self, ofs, adr7, uint8Adr);
+    *num = usbiss_min(len, (size_t) (self->uint16PageSize - (ofs % self->uint16PageSize)));
+    iov[0].base = uint8Adr;
+    iov[0].len = self->uint8AdrBytes;
+    iov[1].base = data;
+    iov[1].len = *num;
+    intRet = usbiss_i2c_wrv(self->usbiss, *adr7, iov, 2);
+    if ( 0 != intRet ) {
+        if ( 0 != self->usbiss->uint8MsgLevel ) {
+            printf("  ERROR:%s: page write adr=0x%02x ofs=0x%x ero=%i\n", __FUNCTION__, *adr7, ofs, intRet);
+        }
+    }
+    return intRet;
+}
+
+
+
+/**
+ *  usbiss_eeprom_wr
+ *    writes memory range page wise
+ */
+int usbiss_eeprom_wr( t_usbiss_eeprom *self, uint32_t ofs, const void* data, size_t len )
+{
+    /** Variables **/
+    uint8_t     uint8Adr7;      // I2C address of block
+    size_t      num;            // bytes in current page
+    size_t      done = 0;       // written bytes
+    int         intRet;         // transfer result
+
+    /* Function Call Message */
+    if ( 0 != self->usbiss->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* memory range */
+    if ( (0 != self->uint32Size) && ((uint64_t) ofs + len > self->uint32Size) ) {
+        if ( 0 != self->usbiss->uint8MsgLevel ) {
+            printf("  ERROR:%s: ofs=0x%x len=%zu exceeds size %u\n", __FUNCTION__, ofs, len, self->uint32Size);
+        }
+        return -1;
+    }
+    /* page wise */
+    while ( done < len ) {
+        intRet = usbiss_eeprom_wr_page(self, ofs + (uint32_t) done, (const uint8_t*) data + done, len - done, &uint8Adr7, &num);
+        if ( 0 != intRet ) {
+            return intRet;
+        }
+        /* next page as soon as internal write cycle finished */
+        intRet = usbiss_eeprom_wr_cycle(self, uint8Adr7);
+        if ( 0 != intRet ) {
+            return intRet;
+        }
+        done += num;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief same chip
+ *
+ *  checks if two jobs program the same EEPROM chip. Block addresses of
+ *  one chip are derived from the same base address.
+ *
+ *  @param[in]      a                   job
+ *  @param[in]      b                   job
+ *  @return         int                 1: same chip
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_eeprom_same_chip( const t_usbiss_eeprom_job *a, const t_usbiss_eeprom_job *b )
+{
+    return ((a->eeprom->usbiss == b->eeprom->usbiss) && (a->eeprom->uint8Adr7 == b->eeprom->uint8Adr7)) ? 1 : 0;
+}
+
+
+
+/**
+ *  usbiss_eeprom_wr_multi
+ *    writes several EEPROMs with interleaved page writes
+ */
+int usbiss_eeprom_wr_multi( t_usbiss_eeprom_job *job, size_t num )
+{
+    /** Variables **/
+    uint64_t    uint64Start = usbiss_eeprom_time_us();  // start of programming
+    uint64_t    uint64Now;                              // current time
+    size_t      open = 0;                               // unfinished jobs
+    size_t      page;                                   // bytes of page write
+    size_t      wait;                                   // earlier job on same chip
+    int         intRet;                                 // transfer result
+
+    /* prepare */
+    for ( size_t i = 0; i < num; i++ ) {
+        job[i].done = 0;
+        job[i].uint8Run = 0;
+        job[i].uint8Busy = 0;
+        job[i].uint8Nack = 0;
+        job[i].uint32Us = 0;
+        job[i].intRet = 0;
+        if ( (0 != job[i].eeprom->uint32Size) && ((uint64_t) job[i].ofs + job[i].len > job[i].eeprom->uint32Size) ) {
+            job[i].intRet = -1;     // range exceeds memory size
+            continue;
+        }
+        job[i].uint8Run = (0 == job[i].len) ? 0 : 1;
+        open += job[i].uint8Run;
+    }
+    /* round robin, one page write per ready EEPROM, busy EEPROMs are probed once per round */
+    while ( 0 != open ) {
+        for ( size_t i = 0; i < num; i++ ) {
+            if ( 0 == job[i].uint8Run ) {
+                continue;   // finished
+            }
+            /* jobs on one chip run one after another */
+            for ( wait = 0; wait < i; wait++ ) {
+                if ( (0 != job[wait].uint8Run) && (0 != usbiss_eeprom_same_chip(&job[wait], &job[i])) ) {
+                    break;
+                }
+            }
+            if ( wait < i ) {
+                continue;
+            }
+            /* write cycle running? */
+            if ( 0 != job[i].uint8Busy ) {
+                intRet = usbiss_i2c_test(job[i].eeprom->usbiss, job[i].uint8BusyAdr7, 1);
+                ++job[i].eeprom->uint32Polls;
+                uint64Now = usbiss_eeprom_time_us();
+                if ( USBISS_ERO_ID1 == intRet ) {
+                    if ( uint64Now < job[i].uint64Tmo ) {
+                        continue;   // serve next EEPROM
+                    }
+                    if ( 0 != job[i].eeprom->usbiss->uint8MsgLevel ) {
+                        printf("  ERROR:%s: write cycle of adr=0x%02x not finished after %u us\n", __FUNCTION__, job[i].uint8BusyAdr7, job[i].eeprom->uint32WrCycleUs);
+                    }
+                }
+                if ( 0 != intRet ) {
+                    job[i].intRet = intRet;
+                    job[i].uint32Us = (uint32_t) (uint64Now - uint64Start);
+                    job[i].uint8Run = 0;
+                    --open;
+                    continue;
+                }
+                job[i].uint8Busy = 0;
+                /* completed */
+                if ( job[i].done == job[i].len ) {
+                    job[i].intRet = 0;
+                    job[i].uint32Us = (uint32_t) (uint64Now - uint64Start);
+                    job[i].uint8Run = 0;
+                    --open;
+                    continue;
+                }
+            }
+            /* next page, NACK if EEPROM is in write cycle of other job on same chip */
+            intRet = usbiss_eeprom_wr_page(job[i].eeprom, job[i].ofs + (uint32_t) job[i].done, (const uint8_t*) job[i].data + job[i].done, job[i].len - job[i].done, &job[i].uint8BusyAdr7, &page);
+            if ( USBISS_ERO_ID1 == intRet ) {
+                uint64Now = usbiss_eeprom_time_us();
+                if ( 0 == job[i].uint8Nack ) {
+                    job[i].uint8Nack = 1;   // timeout starts with first refused page write
+                    job[i].uint64Tmo = uint64Now + job[i].eeprom->uint32WrCycleUs;
+                }
+                if ( uint64Now < job[i].uint64Tmo ) {
+                    job[i].uint8Busy = 1;
+                    continue;
+                }
+            }
+            if ( 0 != intRet ) {
+                job[i].intRet = intRet;
+                job[i].uint32Us = (uint32_t) (usbiss_eeprom_time_us() - uint64Start);
+                job[i].uint8Run = 0;
+                --open;
+                continue;
+            }
+            job[i].done += page;
+            job[i].uint8Nack = 0;
+            job[i].uint8Busy = 1;
+            job[i].uint64Tmo = usbiss_eeprom_time_us() + job[i].eeprom->uint32WrCycleUs;
+        }
+    }
+    /* overall result */
+    for ( size_t i = 0; i < num; i++ ) {
+        if ( 0 != job[i].intRet ) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_eeprom_wr_diff
+ *    writes only changed pages
+ */
+int usbiss_eeprom_wr_diff( t_usbiss_eeprom *self, uint32_t ofs, const void* data, size_t len )
+{
+    /** Variables **/
+    uint8_t     uint8Cur[USBISS_EEPROM_RD_CHUNK];   // current memory content
+    uint8_t     uint8Adr7;                          // I2C address of block
+    const uint8_t*  uint8PtrData = data;            // write data
+    uint32_t    uint32Pos;                          // current offset
+    size_t      chunk;                              // bytes in chunk
+    size_t      page;                               // bytes in page
+    size_t      done = 0;                           // processed bytes
+    int         intRet;                             // transfer result
+
+    /* Function Call Message */
+    if ( 0 != self->usbiss->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* chunks end on chunk aligned offsets, pages are not split between chunks */
+    while ( done < len ) {
+        uint32Pos = ofs + (uint32_t) done;
+        chunk = usbiss_min(len - done, (size_t) (USBISS_EEPROM_RD_CHUNK - (uint32Pos % USBISS_EEPROM_RD_CHUNK)));
+        intRet = usbiss_eeprom_rd(self, uint32Pos, uint8Cur, chunk);    // also checks memory range
+        if ( 0 != intRet ) {
+            return intRet;
+        }
+        /* compare page wise */
+        for ( size_t i = 0; i < chunk; i += page ) {
+            page = usbiss_min(chunk - i, (size_t) (self->uint16PageSize - ((uint32Pos + i) % self->uint16PageSize)));
+            if ( 0 == memcmp(uint8Cur + i, uint8PtrData + done + i, page) ) {
+                ++self->uint32PageSkip;
+                continue;
+            }
+            /* changed, write and verify */
+            intRet = usbiss_eeprom_wr_page(self, uint32Pos + (uint32_t) i, uint8PtrData + done + i, page, &uint8Adr7, &page);
+            if ( 0 == intRet ) {
+                intRet = usbiss_eeprom_wr_cycle(self, uint8Adr7);
+            }
+            if ( 0 == intRet ) {
+                intRet = usbiss_eeprom_rd(self, uint32Pos + (uint32_t) i, uint8Cur + i, page);
+            }
+            if ( 0 != intRet ) {
+                return intRet;
+            }
+            ++self->uint32PageWr;
+            if ( 0 != memcmp(uint8Cur + i, uint8PtrData + done + i, page) ) {
+                if ( 0 != self->usbiss->uint8MsgLevel ) {
+                    printf("  ERROR:%s: verify adr=0x%02x ofs=0x%x failed\n", __FUNCTION__, uint8Adr7, uint32Pos + (uint32_t) i);
+                }
+                return -1;
+            }
+        }
+        done += chunk;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief chunk
+ *
+ *  chunks end on #USBISS_EEPROM_RD_CHUNK aligned offsets
+ *
+ *  @param[in]      ofs                 memory offset
+ *  @param[in]      len                 remaining bytes
+ *  @return         size_t              bytes in chunk
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static size_t usbiss_eeprom_chunk( uint32_t ofs, size_t len )
+{
+    return usbiss_min(len, (size_t) (USBISS_EEPROM_RD_CHUNK - (ofs % USBISS_EEPROM_RD_CHUNK)));
+}
+
+
+
+#if !defined(_WIN32)
+/**
+ *  @brief stream reader
+ *
+ *  reads chunks into free buffer until range end, read error or stop by sink
+ *
+ *  @param[in,out]  arg                 #t_usbiss_eeprom_rdr
+ *  @return         void*               NULL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void* usbiss_eeprom_reader( void* arg )
+{
+    /** Variables **/
+    t_usbiss_eeprom_rdr*    rdr = arg;  // stream
+    size_t                  done = 0;   // read bytes
+    size_t                  num;        // bytes in chunk
+    uint8_t                 b = 0;      // current buffer
+    uint8_t                 stop;       // stopped by sink
+    int                     intRet;     // read result
+
+    while ( done < rdr->len ) {
+        /* wait for free buffer */
+        pthread_mutex_lock(&rdr->mtx);
+        while ( (0 != rdr->full[b]) && (0 == rdr->stop) ) {
+            pthread_cond_wait(&rdr->cond, &rdr->mtx);
+        }
+        stop = rdr->stop;
+        pthread_mutex_unlock(&rdr->mtx);
+        if ( 0 != stop ) {
+            break;
+        }
+        /* read, USB-ISS is owned by reader until stream end */
+        num = usbiss_eeprom_chunk(rdr->ofs + (uint32_t) done, rdr->len - done);
+        intRet = usbiss_eeprom_rd(rdr->self, rdr->ofs + (uint32_t) done, rdr->buf[b], num);
+        pthread_mutex_lock(&rdr->mtx);
+        rdr->num[b] = num;
+        rdr->intRet[b] = intRet;
+        rdr->full[b] = 1;
+        pthread_cond_broadcast(&rdr->cond);
+        pthread_mutex_unlock(&rdr->mtx);
+        if ( 0 != intRet ) {
+            break;
+        }
+        done += num;
+        b ^= 1;
+    }
+    return NULL;
+}
+#endif
+
+
+
+/**
+ *  usbiss_eeprom_rd_stream
+ *    reads memory range overlapped with processing
+ */
+int usbiss_eeprom_rd_stream( t_usbiss_eeprom *self, uint32_t ofs, size_t len, t_usbiss_eeprom_sink sink, void* arg )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    t_usbiss_eeprom_rdr*    rdr;            // double buffered stream
+    pthread_t               thrd;           // reader thread
+    size_t                  done = 0;       // processed bytes
+    size_t                  num;            // bytes in current buffer
+    uint8_t                 b = 0;          // current buffer
+    int                     intRet = 0;     // stream result
+
+    /* Function Call Message */
+    if ( 0 != self->usbiss->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* prepare */
+    rdr = calloc(1, sizeof(t_usbiss_eeprom_rdr));
+    if ( NULL == rdr ) {
+        return -1;
+    }
+    rdr->self = self;
+    rdr->ofs = ofs;
+    rdr->len = len;
+    pthread_mutex_init(&rdr->mtx, NULL);
+    pthread_cond_init(&rdr->cond, NULL);
+    if ( 0 != pthread_create(&thrd, NULL, usbiss_eeprom_reader, rdr) ) {
+        pthread_cond_destroy(&rdr->cond);
+        pthread_mutex_destroy(&rdr->mtx);
+        free(rdr);
+        return -1;
+    }
+    /* consume chunks in memory order */
+    while ( done < len ) {
+        pthread_mutex_lock(&rdr->mtx);
+        while ( 0 == rdr->full[b] ) {
+            pthread_cond_wait(&rdr->cond, &rdr->mtx);
+        }
+        intRet = rdr->intRet[b];    // status of this buffer, a failed next chunk keeps it valid
+        num = rdr->num[b];
+        pthread_mutex_unlock(&rdr->mtx);
+        if ( 0 != intRet ) {
+            break;
+        }
+        if ( 0 != sink(arg, ofs + (uint32_t) done, rdr->buf[b], num) ) {
+            intRet = -1;
+        }
+        pthread_mutex_lock(&rdr->mtx);
+        rdr->stop = (0 != intRet) ? 1 : 0;
+        rdr->full[b] = 0;
+        pthread_cond_broadcast(&rdr->cond);
+        pthread_mutex_unlock(&rdr->mtx);
+        if ( 0 != intRet ) {
+            break;
+        }
+        done += num;
+        b ^= 1;
+    }
+    pthread_join(thrd, NULL);
+    pthread_cond_destroy(&rdr->cond);
+    pthread_mutex_destroy(&rdr->mtx);
+    free(rdr);
+    return intRet;
+#else
+    /** Variables **/
+    uint8_t     uint8Buf[USBISS_EEPROM_RD_CHUNK];   // chunk
+    size_t      done = 0;                           // processed bytes
+    size_t      num;                                // bytes in chunk
+    int         intRet;                             // read result
+
+    /* read and process alternately */
+    while ( done < len ) {
+        num = usbiss_eeprom_chunk(ofs + (uint32_t) done, len - done);
+        intRet = usbiss_eeprom_rd(self, ofs + (uint32_t) done, uint8Buf, num);
+        if ( 0 != intRet ) {
+            return intRet;
+        }
+        if ( 0 != sink(arg, ofs + (uint32_t) done, uint8Buf, num) ) {
+            return -1;
+        }
+        done += num;
+    }
+    return 0;
+#endif
+}
+
+
+
+/**
+ *  @brief CRC32C table driven
+ *
+ *  @param[in]      crc                 inverted CRC
+ *  @param[in]      data                data
+ *  @param[in]      len                 number of bytes
+ *  @return         uint32_t            inverted CRC
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint32_t usbiss_crc32c_sw( uint32_t crc, const uint8_t* data, size_t len )
+{
+    for ( size_t i = 0; i < len; i++ ) {
+        crc = g_usbiss_crc32c_tab[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+/**
+ *  @brief CRC32C SSE4.2
+ *
+ *  compiled for SSE4.2, only called if CPU supports it
+ *
+ *  @param[in]      crc                 inverted CRC
+ *  @param[in]      data                data
+ *  @param[in]      len                 number of bytes
+ *  @return         uint32_t            inverted CRC
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+__attribute__((target("sse4.2")))
+static uint32_t usbiss_crc32c_sse42( uint32_t crc, const uint8_t* data, size_t len )
+{
+    /** Variables **/
+    size_t      i = 0;  // processed bytes
+#if defined(__x86_64__)
+    uint64_t    c64 = crc;  // 64bit CRC register
+    uint64_t    v;          // unaligned data word
+
+    for ( ; i + 8 <= len; i += 8 ) {
+        memcpy(&v, data + i, sizeof(v));
+        c64 = __builtin_ia32_crc32di(c64, v);
+    }
+    crc = (uint32_t) c64;
+#endif
+    for ( ; i < len; i++ ) {
+        crc = __builtin_ia32_crc32qi(crc, data[i]);
+    }
+    return crc;
+}
+#endif
+
+
+
+/**
+ *  usbiss_crc32c
+ *    CRC32C with hardware support
+ */
+uint32_t usbiss_crc32c( uint32_t crc, const void* data, size_t len )
+{
+    /** Variables **/
+    const uint8_t*  uint8PtrData = data;    // data
+
+    crc = ~crc;
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    if ( 0 != __builtin_cpu_supports("sse4.2") ) {
+        return ~usbiss_crc32c_sse42(crc, uint8PtrData, len);
+    }
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+    {
+        size_t      i = 0;  // processed bytes
+        uint64_t    v;      // unaligned data word
+        for ( ; i + 8 <= len; i += 8 ) {
+            memcpy(&v, uint8PtrData + i, sizeof(v));
+            crc = __crc32cd(crc, v);
+        }
+        for ( ; i < len; i++ ) {
+            crc = __crc32cb(crc, uint8PtrData[i]);
+        }
+        return ~crc;
+    }
+#endif
+    return ~usbiss_crc32c_sw(crc, uint8PtrData, len);
+}
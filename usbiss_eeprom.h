@@ -0,0 +1,332 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_eeprom.h
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS serial EEPROM access
+                  24Cxx style I2C EEPROMs:
+                    * sequential read in large chunks
+                    * page write split on page boundaries
+                    * ACK polling of write cycle
+                    * part table with page sizes
+                    * interleaved programming of several EEPROMs
+                    * differential programming of changed pages
+                    * streamed read back with CRC32C
+***********************************************************************/
+
+
+
+// Define Guard
+#ifndef __USB_ISS_EEPROM_H
+#define __USB_ISS_EEPROM_H
+
+
+/** Includes **/
+#include <stddef.h>     // size_t
+#include <stdint.h>     // defines fixed data types, like int8_t...
+#include "usbiss.h"     // USBISS driver
+
+
+
+/**
+ *  @defgroup USBISS_EEPROM
+ *  EEPROM access
+ *
+ *  @{
+ */
+#define USBISS_EEPROM_TWR_US    (5000)  /**< worst case write cycle time of 24Cxx */
+#define USBISS_EEPROM_TMO_US    (2 * USBISS_EEPROM_TWR_US)  /**< ACK polling gives up after this time */
+#define USBISS_EEPROM_POLL_NUM  (4)     /**< address tests per USB request, see #usbiss_i2c_test */
+#define USBISS_EEPROM_RD_CHUNK  (4096)  /**< maximum read bytes per I2C transfer */
+#define USBISS_EEPROM_PAGE_MAX  (256)   /**< maximum supported page size */
+/** @} */   // USBISS_EEPROM
+
+
+
+/**
+ *  @typedef t_usbiss_eeprom
+ *
+ *  @brief  EEPROM description
+ *
+ *  Memory beyond the word address range is selected by the lower three
+ *  I2C address bits, f.e. 24C16 or 24C1024.
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_eeprom {
+    t_usbiss*   usbiss;             /**<  opened USB-ISS */
+    uint8_t     uint8Adr7;          /**<  Seven Bit I2C address, block select bits zero */
+    uint8_t     uint8AdrBytes;      /**<  number of word address bytes, 1 or 2 */
+    uint16_t    uint16PageSize;     /**<  write page size in bytes */
+    uint32_t    uint32Size;         /**<  memory size in bytes, 0: unknown, no range check */
+    uint32_t    uint32WrCycleUs;    /**<  ACK polling timeout after page write */
+    uint32_t    uint32Polls;        /**<  address tests issued since init, statistic */
+    uint32_t    uint32PageWr;       /**<  differential: written pages since init, statistic */
+    uint32_t    uint32PageSkip;     /**<  differential: unchanged pages since init, statistic */
+} t_usbiss_eeprom;
+
+
+
+/**
+ *  @typedef t_usbiss_eeprom_part
+ *
+ *  @brief  EEPROM part
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_eeprom_part {
+    uint16_t    uint16Kbit;         /**<  density in kbit, f.e. 256 for 24C256 */
+    uint8_t     uint8AdrBytes;      /**<  number of word address bytes */
+    uint16_t    uint16PageSize;     /**<  write page size in bytes */
+} t_usbiss_eeprom_part;
+
+
+
+/**
+ *  @typedef t_usbiss_eeprom_job
+ *
+ *  @brief  EEPROM programming job
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_eeprom_job {
+    t_usbiss_eeprom*    eeprom;         /**<  initialized EEPROM handle */
+    uint32_t            ofs;            /**<  memory offset */
+    const void*         data;           /**<  write data */
+    size_t              len;            /**<  number of bytes to write */
+    size_t              done;           /**<  written bytes */
+    int                 intRet;         /**<  job result, see #usbiss_eeprom_wr */
+    uint32_t            uint32Us;       /**<  job finished after this time since start */
+    uint8_t             uint8Run;       /**<  internal: job not finished */
+    uint8_t             uint8Busy;      /**<  internal: write cycle running */
+    uint8_t             uint8BusyAdr7;  /**<  internal: I2C address of written block */
+    uint8_t             uint8Nack;      /**<  internal: page write not acknowledged, timeout running */
+    uint64_t            uint64Tmo;      /**<  internal: write cycle timeout */
+} t_usbiss_eeprom_job;
+
+
+
+/**
+ *  @typedef t_usbiss_eeprom_sink
+ *
+ *  @brief  stream consumer
+ *
+ *  called for every read chunk in memory order, while the next chunk
+ *  is read from the EEPROM
+ *
+ *  @param[in,out]  arg                 user argument
+ *  @param[in]      ofs                 memory offset of chunk
+ *  @param[in]      data                chunk data
+ *  @param[in]      len                 number of bytes in chunk
+ *  @return         int                 0: continue, otherwise stops stream
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+typedef int (*t_usbiss_eeprom_sink)( void* arg, uint32_t ofs, const uint8_t* data, size_t len );
+
+
+
+/**
+ *  @brief C++ Guard
+ *
+ *  Make usable with C++ compiler
+ *
+ *  @see https://stackoverflow.com/questions/14997165/how-to-call-c-function-from-c
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+
+
+/**
+ *  @brief init
+ *
+ *  initializes EEPROM description, memory size is unknown and write cycle
+ *  timeout is set to #USBISS_EEPROM_TMO_US
+ *
+ *  @param[in,out]  self                EEPROM handle
+ *  @param[in]      usbiss              opened USB-ISS
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      adrBytes            number of word address bytes, 1 or 2
+ *  @param[in]      pageSize            write page size in bytes, max #USBISS_EEPROM_PAGE_MAX
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_eeprom_init( t_usbiss_eeprom *self, t_usbiss *usbiss, uint8_t adr7, uint8_t adrBytes, uint16_t pageSize );
+
+
+
+/**
+ *  @brief init part
+ *
+ *  initializes EEPROM description from part table. Vendor prefixes and
+ *  technology letters are ignored, f.e. AT24C256, 24LC256 and M24256
+ *  select the same geometry.
+ *
+ *  @param[in,out]  self                EEPROM handle
+ *  @param[in]      usbiss              opened USB-ISS
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      part                part name, f.e. 24C02, 24C256, 24M01
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, unknown part
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_eeprom_init_part( t_usbiss_eeprom *self, t_usbiss *usbiss, uint8_t adr7, const char* part );
+
+
+
+/**
+ *  @brief read
+ *
+ *  reads memory range with sequential reads, one I2C transfer per
+ *  #USBISS_EEPROM_RD_CHUNK or block select boundary
+ *
+ *  @param[in,out]  self                EEPROM handle
+ *  @param[in]      ofs                 memory offset
+ *  @param[out]     data                read data
+ *  @param[in]      len                 number of bytes to read
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, f.e. range exceeds memory size
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_eeprom_rd( t_usbiss_eeprom *self, uint32_t ofs, void* data, size_t len );
+
+
+
+/**
+ *  @brief write
+ *
+ *  writes memory range, splits into page writes. After every page the
+ *  device is polled for ACK, the next page is sent as soon as the write
+ *  cycle finished.
+ *
+ *  @param[in,out]  self                EEPROM handle
+ *  @param[in]      ofs                 memory offset
+ *  @param[in]      data                write data
+ *  @param[in]      len                 number of bytes to write
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, f.e. range exceeds memory size
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR, #USBISS_ERO_ID1 if write cycle timed out
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_eeprom_wr( t_usbiss_eeprom *self, uint32_t ofs, const void* data, size_t len );
+
+
+
+/**
+ *  @brief write multiple
+ *
+ *  writes several EEPROMs on one bus with interleaved page writes. While
+ *  one EEPROM runs its internal write cycle the next page goes to
+ *  another EEPROM. Busy EEPROMs are probed once per round, see
+ *  #usbiss_i2c_test. Jobs on the same chip, same USB-ISS and base address,
+ *  run one after another in list order. A not acknowledged page write
+ *  counts as busy until uint32WrCycleUs, f.e. if handles with different
+ *  base addresses share one chip. EEPROMs of one job list need to share
+ *  the USB-ISS.
+ *
+ *  @param[in,out]  job                 programming jobs, per job result in intRet and uint32Us
+ *  @param[in]      num                 number of jobs
+ *  @return         int
+ *  @retval         0                   all jobs OK
+ *  @retval         -1                  at least one job failed
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_eeprom_wr_multi( t_usbiss_eeprom_job *job, size_t num );
+
+
+
+/**
+ *  @brief write differential
+ *
+ *  reads memory range in chunks of #USBISS_EEPROM_RD_CHUNK and compares
+ *  page wise with data. Only changed pages are written and verified by
+ *  read back.
+ *
+ *  @param[in,out]  self                EEPROM handle, page statistic in uint32PageWr and uint32PageSkip
+ *  @param[in]      ofs                 memory offset
+ *  @param[in]      data                write data
+ *  @param[in]      len                 number of bytes to write
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, f.e. verify mismatch
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_eeprom_wr_diff( t_usbiss_eeprom *self, uint32_t ofs, const void* data, size_t len );
+
+
+
+/**
+ *  @brief read stream
+ *
+ *  reads memory range in chunks of #USBISS_EEPROM_RD_CHUNK and passes
+ *  them to sink. A reader thread fills two buffers alternately, the
+ *  sink processes one chunk while the next is transferred. Without
+ *  POSIX threads (Windows) read and sink alternate.
+ *
+ *  @param[in,out]  self                EEPROM handle
+ *  @param[in]      ofs                 memory offset
+ *  @param[in]      len                 number of bytes to read
+ *  @param[in]      sink                chunk consumer
+ *  @param[in,out]  arg                 argument of sink
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, f.e. stopped by sink
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_eeprom_rd_stream( t_usbiss_eeprom *self, uint32_t ofs, size_t len, t_usbiss_eeprom_sink sink, void* arg );
+
+
+
+/**
+ *  @brief CRC32C
+ *
+ *  Castagnoli CRC, uses SSE4.2 or ARMv8 CRC instructions if available,
+ *  otherwise table driven. Start with crc 0, pass the result for
+ *  following data.
+ *
+ *  @param[in]      crc                 CRC of previous data, 0 at start
+ *  @param[in]      data                data
+ *  @param[in]      len                 number of bytes
+ *  @return         uint32_t            CRC32C, "123456789" results in 0xe3069283
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+uint32_t usbiss_crc32c( uint32_t crc, const void* data, size_t len );
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+
+#endif // __USB_ISS_EEPROM_H
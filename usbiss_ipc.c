@@ -0,0 +1,517 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_ipc.c
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS daemon
+                  keeps USB-ISS open and serves clients over an
+                  Unix domain socket:
+                    * server loop
+                    * client access functions
+***********************************************************************/
+
+
+
+/** Includes **/
+/* Standard libs */
+#include <stdio.h>      // f.e. printf
+#include <stdlib.h>     // malloc
+#include <stdint.h>     // defines fixed data types, like int8_t...
+#include <string.h>     // string handling functions
+#if !defined(_WIN32)
+    #include <errno.h>      // EINTR
+    #include <poll.h>       // poll
+    #include <unistd.h>     // close, unlink
+    #include <sys/socket.h> // socket
+    #include <sys/un.h>     // sockaddr_un
+#endif
+/** self **/
+#include "usbiss.h"     // USBISS driver
+#include "usbiss_ipc.h" // some defs
+
+
+
+#if !defined(_WIN32)
+
+/**
+ *  @brief socket transfer
+ *
+ *  transfers len bytes, waits at most #USBISS_IPC_TMO_MS for every fragment
+ *
+ *  @param[in]      fd                  socket
+ *  @param[in,out]  data                data buffer
+ *  @param[in]      len                 number of bytes
+ *  @param[in]      wr                  1: send, 0: receive
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL or peer closed
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_ipc_io( int fd, void* data, size_t len, uint8_t wr )
+{
+    /** Variables **/
+    struct pollfd   pfd;        // wait for socket
+    size_t          done = 0;   // transferred bytes
+    ssize_t         r;          // transferred bytes of fragment
+    int             intRdy;     // poll result
+
+    pfd.fd = fd;
+    pfd.events = (short) ((0 != wr) ? POLLOUT : POLLIN);
+    while ( done < len ) {
+        intRdy = poll(&pfd, 1, USBISS_IPC_TMO_MS);
+        if ( (-1 == intRdy) && (EINTR == errno) ) {
+            continue;
+        }
+        if ( 1 != intRdy ) {
+            return -1;  // timeout or error
+        }
+        if ( 0 != wr ) {
+            r = send(fd, (uint8_t*) data + done, len - done, MSG_NOSIGNAL);     // closed client should not kill daemon
+        } else {
+            r = recv(fd, (uint8_t*) data + done, len - done, 0);
+        }
+        if ( !(0 < r) ) {
+            if ( (0 > r) && (EINTR == errno) ) {
+                continue;
+            }
+            return -1;
+        }
+        done += (size_t) r;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief socket address
+ *
+ *  @param[out]     adr                 socket address
+ *  @param[in]      path                socket path, NULL: #USBISS_IPC_SOCKET
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, path too long
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_ipc_adr( struct sockaddr_un* adr, const char* path )
+{
+    if ( NULL == path ) {
+        path = USBISS_IPC_SOCKET;
+    }
+    memset(adr, 0, sizeof(*adr));
+    adr->sun_family = AF_UNIX;
+    if ( !(strlen(path) < sizeof(adr->sun_path)) ) {
+        return -1;
+    }
+    strncpy(adr->sun_path, path, sizeof(adr->sun_path) - 1);
+    return 0;
+}
+
+
+
+/**
+ *  @brief client request
+ *
+ *  processes one request of client, called if the client socket is
+ *  readable. Fragments of the started request are awaited at most
+ *  #USBISS_IPC_TMO_MS.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss
+ *  @param[in]      fd                  client socket
+ *  @param[in]      buf                 data buffer, 2*#USBISS_IPC_MAX_DATA
+ *  @return         int
+ *  @retval         0                   OK, request served
+ *  @retval         -1                  client closed, stalled or malformed request
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_ipc_client( t_usbiss *self, int fd, uint8_t* buf )
+{
+    /** Variables **/
+    t_usbiss_ipc_req    req;        // request header
+    t_usbiss_ipc_rsp    rsp;        // response header
+    t_usbiss_ipc_info   info;       // adapter information
+    t_usbiss_i2c_xfer   xfer;       // I2C transfer
+    uint8_t*            wr = buf;                       // write data
+    uint8_t*            rd = buf + USBISS_IPC_MAX_DATA; // read data
+    char                charMode[32];                   // transfer mode
+    int                 intRet;                         // driver result
+
+    if ( 0 != usbiss_ipc_io(fd, &req, sizeof(req), 0) ) {
+        return -1;
+    }
+    /* check header */
+    if ( (USBISS_IPC_MAGIC != req.uint8Magic) || (req.uint16WrLen > USBISS_IPC_MAX_DATA) || (req.uint16RdLen > USBISS_IPC_MAX_DATA) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: malformed request, drop client\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    if ( 0 != usbiss_ipc_io(fd, wr, req.uint16WrLen, 0) ) {
+        return -1;
+    }
+    /* process */
+    memset(&rsp, 0, sizeof(rsp));
+    rsp.uint8Magic = USBISS_IPC_MAGIC;
+    rsp.uint8Op = req.uint8Op;
+    switch ( req.uint8Op ) {
+        case USBISS_IPC_INFO:
+            memset(&info, 0, sizeof(info));
+            info.uint8Fw = self->uint8Fw;
+            info.uint8Mode = self->uint8Mode;
+            strncpy(info.charSerial, self->charSerial, sizeof(info.charSerial) - 1);
+            strncpy(info.charPort, self->charPort, sizeof(info.charPort) - 1);
+            memcpy(rd, &info, sizeof(info));
+            rsp.uint16Len = sizeof(info);
+            break;
+        case USBISS_IPC_MODE:
+            snprintf(charMode, sizeof(charMode), "%.*s", (int) req.uint16WrLen, (char*) wr);
+            rsp.int16Ret = (int16_t) usbiss_set_mode(self, charMode);
+            break;
+        case USBISS_IPC_XFER:
+            xfer.uint8Adr7 = req.uint8Adr7;
+            xfer.wr = wr;
+            xfer.wrLen = req.uint16WrLen;
+            xfer.rd = rd;
+            xfer.rdLen = req.uint16RdLen;
+            intRet = usbiss_i2c_xfer(self, &xfer);
+            rsp.int16Ret = (int16_t) intRet;
+            rsp.uint16Len = (0 == intRet) ? req.uint16RdLen : 0;
+            break;
+        case USBISS_IPC_SCAN:
+            intRet = usbiss_i2c_scan(self, (int8_t) req.uint8Adr7, (int8_t) req.uint8Arg, (int8_t*) rd, USBISS_I2C_NUM_ADR);
+            rsp.int16Ret = (int16_t) intRet;
+            rsp.uint16Len = (uint16_t) ((0 < intRet) ? intRet : 0);
+            break;
+        default:
+            rsp.int16Ret = -1;
+            break;
+    }
+    /* answer */
+    if ( (0 != usbiss_ipc_io(fd, &rsp, sizeof(rsp), 1)) || (0 != usbiss_ipc_io(fd, rd, rsp.uint16Len, 1)) ) {
+        return -1;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief client request
+ *
+ *  sends request and receives response
+ *
+ *  @param[in]      fd                  socket
+ *  @param[in]      req                 request header
+ *  @param[in]      wr                  write data
+ *  @param[out]     rsp                 response header
+ *  @param[out]     rd                  response data
+ *  @param[in]      rdMax               size of rd
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_ipc_req( int fd, t_usbiss_ipc_req* req, const void* wr, t_usbiss_ipc_rsp* rsp, void* rd, size_t rdMax )
+{
+    req->uint8Magic = USBISS_IPC_MAGIC;
+    if ( (0 != usbiss_ipc_io(fd, req, sizeof(*req), 1)) || (0 != usbiss_ipc_io(fd, (void*) wr, req->uint16WrLen, 1)) ) {
+        return -1;
+    }
+    if ( 0 != usbiss_ipc_io(fd, rsp, sizeof(*rsp), 0) ) {
+        return -1;
+    }
+    if ( (USBISS_IPC_MAGIC != rsp->uint8Magic) || (req->uint8Op != rsp->uint8Op) || (rsp->uint16Len > rdMax) ) {
+        return -1;
+    }
+    return usbiss_ipc_io(fd, rd, rsp->uint16Len, 0);
+}
+
+#endif  // !_WIN32
+
+
+
+/**
+ *  usbiss_ipc_serve
+ *    serve clients over Unix domain socket
+ */
+int usbiss_ipc_serve( t_usbiss *self, const char* path, volatile sig_atomic_t* stop )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    struct sockaddr_un  adr;    // socket address
+    struct pollfd       pfd[1+USBISS_IPC_MAX_CLIENT];   // listen socket + clients
+    nfds_t              num = 1;    // used elements in pfd
+    uint8_t*            buf;    // write/read data
+    int                 fd;     // listen socket
+    int                 cl;     // client socket
+    int                 intRdy; // poll result
+
+    /* Function Call Message */
+    if ( 0 != self->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* USBISS open? */
+    if ( !self->uint8IsOpen ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: USBISS connection not open\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    /* listen */
+    if ( 0 != usbiss_ipc_adr(&adr, path) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: socket path too long\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ( 0 > fd ) {
+        return -1;
+    }
+    unlink(adr.sun_path);   // stale socket of previous run
+    if ( (0 != bind(fd, (struct sockaddr*) &adr, sizeof(adr))) || (0 != listen(fd, 8)) ) {
+        if ( 0 != self->uint8MsgLevel ) {
+            printf("  ERROR:%s: bind to '%s'\n", __FUNCTION__, adr.sun_path);
+        }
+        close(fd);
+        return -1;
+    }
+    buf = malloc(2*USBISS_IPC_MAX_DATA);
+    if ( NULL == buf ) {
+        close(fd);
+        unlink(adr.sun_path);
+        return -1;
+    }
+    /* serve, one request per ready client and round, idle clients stay connected */
+    pfd[0].fd = fd;
+    pfd[0].events = POLLIN;
+    while ( (NULL == stop) || (0 == *stop) ) {
+        intRdy = poll(pfd, num, USBISS_IPC_POLL_MS);
+        if ( !(0 < intRdy) ) {
+            usbiss_hotplug_poll(self);  // reconnect lost adapter while idle, signal checks stop
+            continue;
+        }
+        /* requests, dropped clients are replaced by last one */
+        for ( nfds_t i = num - 1; i > 0; i-- ) {
+            if ( 0 == pfd[i].revents ) {
+                continue;
+            }
+            if ( (0 != (pfd[i].revents & (POLLERR | POLLNVAL))) || (0 != usbiss_ipc_client(self, pfd[i].fd, buf)) ) {
+                close(pfd[i].fd);
+                pfd[i] = pfd[--num];
+            }
+        }
+        /* new client */
+        if ( 0 != (pfd[0].revents & POLLIN) ) {
+            cl = accept(fd, NULL, NULL);
+            if ( !(0 > cl) ) {
+                if ( num < sizeof(pfd)/sizeof(pfd[0]) ) {
+                    pfd[num].fd = cl;
+                    pfd[num].events = POLLIN;
+                    pfd[num].revents = 0;
+                    ++num;
+                } else {
+                    if ( 0 != self->uint8MsgLevel ) {
+                        printf("  ERROR:%s: more than %i clients, refused\n", __FUNCTION__, USBISS_IPC_MAX_CLIENT);
+                    }
+                    close(cl);
+                }
+            }
+        }
+    }
+    /* clean-up */
+    for ( nfds_t i = 1; i < num; i++ ) {
+        close(pfd[i].fd);
+    }
+    free(buf);
+    close(fd);
+    unlink(adr.sun_path);
+    return 0;
+#else
+    (void) path;
+    (void) stop;
+    if ( 0 != self->uint8MsgLevel ) {
+        printf("  ERROR:%s: not supported on this platform\n", __FUNCTION__);
+    }
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_ipc_connect
+ *    connect to daemon
+ */
+int usbiss_ipc_connect( const char* path )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    struct sockaddr_un  adr;    // socket address
+    int                 fd;     // socket
+
+    if ( 0 != usbiss_ipc_adr(&adr, path) ) {
+        return -1;
+    }
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ( 0 > fd ) {
+        return -1;
+    }
+    if ( 0 != connect(fd, (struct sockaddr*) &adr, sizeof(adr)) ) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+#else
+    (void) path;
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_ipc_close
+ *    disconnect from daemon
+ */
+void usbiss_ipc_close( int fd )
+{
+#if !defined(_WIN32)
+    if ( !(0 > fd) ) {
+        close(fd);
+    }
+#else
+    (void) fd;
+#endif
+}
+
+
+
+/**
+ *  usbiss_ipc_info
+ *    adapter information
+ */
+int usbiss_ipc_info( int fd, t_usbiss_ipc_info* info )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    t_usbiss_ipc_req    req;    // request header
+    t_usbiss_ipc_rsp    rsp;    // response header
+
+    memset(&req, 0, sizeof(req));
+    req.uint8Op = USBISS_IPC_INFO;
+    if ( (0 != usbiss_ipc_req(fd, &req, NULL, &rsp, info, sizeof(*info))) || (sizeof(*info) != rsp.uint16Len) ) {
+        return -1;
+    }
+    return rsp.int16Ret;
+#else
+    (void) fd;
+    (void) info;
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_ipc_set_mode
+ *    set transfer mode
+ */
+int usbiss_ipc_set_mode( int fd, const char* mode )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    t_usbiss_ipc_req    req;    // request header
+    t_usbiss_ipc_rsp    rsp;    // response header
+
+    memset(&req, 0, sizeof(req));
+    req.uint8Op = USBISS_IPC_MODE;
+    req.uint16WrLen = (uint16_t) strnlen(mode, 32);
+    if ( 0 != usbiss_ipc_req(fd, &req, mode, &rsp, NULL, 0) ) {
+        return -1;
+    }
+    return rsp.int16Ret;
+#else
+    (void) fd;
+    (void) mode;
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_ipc_i2c
+ *    I2C transfer
+ */
+int usbiss_ipc_i2c( int fd, uint8_t adr7, const void* wr, size_t wrLen, void* rd, size_t rdLen )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    t_usbiss_ipc_req    req;    // request header
+    t_usbiss_ipc_rsp    rsp;    // response header
+
+    if ( (wrLen > USBISS_IPC_MAX_DATA) || (rdLen > USBISS_IPC_MAX_DATA) ) {
+        return -1;
+    }
+    memset(&req, 0, sizeof(req));
+    req.uint8Op = USBISS_IPC_XFER;
+    req.uint8Adr7 = adr7;
+    req.uint16WrLen = (uint16_t) wrLen;
+    req.uint16RdLen = (uint16_t) rdLen;
+    if ( 0 != usbiss_ipc_req(fd, &req, wr, &rsp, rd, rdLen) ) {
+        return -1;
+    }
+    return rsp.int16Ret;
+#else
+    (void) fd;
+    (void) adr7;
+    (void) wr;
+    (void) wrLen;
+    (void) rd;
+    (void) rdLen;
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_ipc_i2c_scan
+ *    I2C scan
+ */
+int usbiss_ipc_i2c_scan( int fd, int8_t start, int8_t stop, int8_t* i2c, uint8_t len )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    t_usbiss_ipc_req    req;    // request header
+    t_usbiss_ipc_rsp    rsp;    // response header
+
+    memset(&req, 0, sizeof(req));
+    req.uint8Op = USBISS_IPC_SCAN;
+    req.uint8Adr7 = (uint8_t) start;
+    req.uint8Arg = (uint8_t) stop;
+    if ( 0 != usbiss_ipc_req(fd, &req, NULL, &rsp, i2c, len) ) {
+        return -1;
+    }
+    return rsp.int16Ret;
+#else
+    (void) fd;
+    (void) start;
+    (void) stop;
+    (void) i2c;
+    (void) len;
+    return -1;
+#endif
+}
@@ -0,0 +1,252 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_ipc.h
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS daemon
+                  keeps USB-ISS open and serves clients over an
+                  Unix domain socket:
+                    * server loop
+                    * client access functions
+***********************************************************************/
+
+
+
+// Define Guard
+#ifndef __USB_ISS_IPC_H
+#define __USB_ISS_IPC_H
+
+
+/** Includes **/
+#include <signal.h>     // sig_atomic_t
+#include "usbiss.h"     // USBISS driver
+
+
+
+/**
+ *  @defgroup USBISS_IPC
+ *  Unix domain socket protocol
+ *
+ *  request: #t_usbiss_ipc_req followed by write data,
+ *  response: #t_usbiss_ipc_rsp followed by read data.
+ *  Local socket, fields are in host byte order.
+ *
+ *  @{
+ */
+#define USBISS_IPC_SOCKET   "/tmp/usbiss.sock"  /**< default socket path */
+#define USBISS_IPC_MAGIC    (0x55)              /**< frame start */
+#define USBISS_IPC_INFO     (0x01)              /**< adapter information, response data #t_usbiss_ipc_info */
+#define USBISS_IPC_MODE     (0x02)              /**< set transfer mode, write data is mode name */
+#define USBISS_IPC_XFER     (0x03)              /**< I2C transfer, see #usbiss_i2c_xfer */
+#define USBISS_IPC_SCAN     (0x04)              /**< I2C scan, uint8Adr7: start, uint8Arg: stop, response data found addresses */
+#define USBISS_IPC_MAX_DATA (4096)              /**< maximum write/read data per request */
+#define USBISS_IPC_TMO_MS   (1000)              /**< server waits for stalled fragment of started request */
+#define USBISS_IPC_MAX_CLIENT   (16)            /**< maximum number of connected clients */
+#define USBISS_IPC_POLL_MS  (100)               /**< server idle poll interval */
+/** @} */   // USBISS_IPC
+
+
+
+/**
+ *  @typedef t_usbiss_ipc_req
+ *
+ *  @brief  request header
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_ipc_req {
+    uint8_t     uint8Magic;     /**<  #USBISS_IPC_MAGIC */
+    uint8_t     uint8Op;        /**<  operation, #USBISS_IPC */
+    uint8_t     uint8Adr7;      /**<  Seven Bit I2C address */
+    uint8_t     uint8Arg;       /**<  operation argument */
+    uint16_t    uint16WrLen;    /**<  number of following write bytes */
+    uint16_t    uint16RdLen;    /**<  number of requested read bytes */
+} t_usbiss_ipc_req;
+
+
+
+/**
+ *  @typedef t_usbiss_ipc_rsp
+ *
+ *  @brief  response header
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_ipc_rsp {
+    uint8_t     uint8Magic;     /**<  #USBISS_IPC_MAGIC */
+    uint8_t     uint8Op;        /**<  operation of request */
+    int16_t     int16Ret;       /**<  return value of driver function */
+    uint16_t    uint16Len;      /**<  number of following data bytes */
+    uint16_t    uint16Rsv;      /**<  reserved */
+} t_usbiss_ipc_rsp;
+
+
+
+/**
+ *  @typedef t_usbiss_ipc_info
+ *
+ *  @brief  adapter information
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_ipc_info {
+    uint8_t     uint8Fw;            /**<  firmware version */
+    uint8_t     uint8Mode;          /**<  current mode */
+    char        charSerial[10];     /**<  serial number */
+    char        charPort[128];      /**<  UART port */
+} t_usbiss_ipc_info;
+
+
+
+/**
+ *  @brief C++ Guard
+ *
+ *  Make usable with C++ compiler
+ *
+ *  @see https://stackoverflow.com/questions/14997165/how-to-call-c-function-from-c
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+
+
+/**
+ *  @brief serve
+ *
+ *  serves clients on Unix domain socket with opened USB-ISS. Up to
+ *  #USBISS_IPC_MAX_CLIENT clients stay connected, every client can issue any
+ *  number of requests. Ready clients are served one request after another,
+ *  idle clients are not dropped. Access is controlled by the file
+ *  permissions of the socket.
+ *
+ *  @param[in,out]  self                common handle #t_usbiss, opened
+ *  @param[in]      path                socket path, NULL: #USBISS_IPC_SOCKET
+ *  @param[in]      stop                server ends if set to non-zero, f.e. by signal handler
+ *  @return         int
+ *  @retval         0                   OK, stopped
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_ipc_serve( t_usbiss *self, const char* path, volatile sig_atomic_t* stop );
+
+
+
+/**
+ *  @brief connect
+ *
+ *  connects to daemon
+ *
+ *  @param[in]      path                socket path, NULL: #USBISS_IPC_SOCKET
+ *  @return         int                 socket, -1 on failure
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_ipc_connect( const char* path );
+
+
+
+/**
+ *  @brief disconnect
+ *
+ *  @param[in]      fd                  socket, see #usbiss_ipc_connect
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+void usbiss_ipc_close( int fd );
+
+
+
+/**
+ *  @brief info
+ *
+ *  requests information of adapter served by daemon
+ *
+ *  @param[in]      fd                  socket, see #usbiss_ipc_connect
+ *  @param[out]     info                adapter information
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_ipc_info( int fd, t_usbiss_ipc_info* info );
+
+
+
+/**
+ *  @brief mode
+ *
+ *  sets transfer mode of adapter served by daemon, see #usbiss_set_mode
+ *
+ *  @param[in]      fd                  socket, see #usbiss_ipc_connect
+ *  @param[in]      mode                transfer mode, f.e. I2C_S_100KHZ
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_ipc_set_mode( int fd, const char* mode );
+
+
+
+/**
+ *  @brief I2C transfer
+ *
+ *  I2C write, read or write-read with repeated start by daemon
+ *
+ *  @param[in]      fd                  socket, see #usbiss_ipc_connect
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      wr                  write data
+ *  @param[in]      wrLen               number of bytes to write
+ *  @param[out]     rd                  read data, allowed to be equal wr
+ *  @param[in]      rdLen               number of bytes to read
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_ipc_i2c( int fd, uint8_t adr7, const void* wr, size_t wrLen, void* rd, size_t rdLen );
+
+
+
+/**
+ *  @brief I2C scan
+ *
+ *  I2C scan by daemon, see #usbiss_i2c_scan
+ *
+ *  @param[in]      fd                  socket, see #usbiss_ipc_connect
+ *  @param[in]      start               start address
+ *  @param[in]      stop                stop address
+ *  @param[out]     i2c                 found I2C addresses
+ *  @param[in]      len                 maximum number of elements in i2c
+ *  @return         int                 number of found devices, -1 on failure
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_ipc_i2c_scan( int fd, int8_t start, int8_t stop, int8_t* i2c, uint8_t len );
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+
+#endif // __USB_ISS_IPC_H
@@ -0,0 +1,316 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_log.c
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS capture ring file
+                  logs timestamped samples into a memory mapped file:
+                    * fixed size binary records, bounded file size
+                    * one writer, lock free tailing readers
+                    * ring continues after writer restart
+                    * offline CSV export
+***********************************************************************/
+
+
+
+/** Includes **/
+/* Standard libs */
+#include <stdio.h>      // f.e. printf
+#include <stdint.h>     // defines fixed data types, like int8_t...
+#include <inttypes.h>   // PRIu64
+#include <string.h>     // memcpy
+#if !defined(_WIN32)
+    #include <fcntl.h>      // open
+    #include <time.h>       // clock_gettime
+    #include <unistd.h>     // ftruncate, close
+    #include <sys/mman.h>   // mmap
+    #include <sys/stat.h>   // fstat
+#endif
+/** self **/
+#include "usbiss_log.h" // some defs
+
+
+
+#if !defined(_WIN32)
+
+/**
+ *  @brief time
+ *
+ *  @param[in]      clk                 CLOCK_MONOTONIC or CLOCK_REALTIME
+ *  @return         uint64_t            time in us
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint64_t usbiss_log_time_us( clockid_t clk )
+{
+    struct timespec ts;
+    clock_gettime(clk, &ts);
+    return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) ts.tv_nsec / 1000;
+}
+
+#endif  // !_WIN32
+
+
+
+/**
+ *  usbiss_log_create
+ *    opens ring file for writing
+ */
+int usbiss_log_create( t_usbiss_log *self, const char* path, uint32_t slots )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    struct stat         st;     // file size
+    t_usbiss_log_hdr*   hdr;    // mapped file
+    size_t              size;   // file size of ring
+    int                 fd;     // ring file
+
+    /* init */
+    memset(self, 0, sizeof(*self));
+    slots = (0 != slots) ? slots : USBISS_LOG_SLOTS;
+    size = sizeof(t_usbiss_log_hdr) + (size_t) slots * sizeof(t_usbiss_log_rec);
+    /* open and size */
+    fd = open(path, O_RDWR | O_CREAT, 0644);
+    if ( 0 > fd ) {
+        return -1;
+    }
+    if ( (0 != fstat(fd, &st)) || ((size != (size_t) st.st_size) && (0 != ftruncate(fd, (off_t) size))) ) {
+        close(fd);
+        return -1;
+    }
+    hdr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if ( MAP_FAILED == hdr ) {
+        return -1;
+    }
+    /* continue ring of same layout, otherwise initialize */
+    if ( (size != (size_t) st.st_size) || (USBISS_LOG_MAGIC != hdr->uint32Magic) || (USBISS_LOG_VERSION != hdr->uint16Version) || (sizeof(t_usbiss_log_rec) != hdr->uint16RecSize) || (slots != hdr->uint32Slots) ) {
+        __atomic_store_n(&hdr->uint32Magic, 0, __ATOMIC_RELEASE);
+        memset((uint8_t*) hdr + sizeof(hdr->uint32Magic), 0, size - sizeof(hdr->uint32Magic));
+        hdr->uint16Version = USBISS_LOG_VERSION;
+        hdr->uint16RecSize = (uint16_t) sizeof(t_usbiss_log_rec);
+        hdr->uint32Slots = slots;
+        __atomic_store_n(&hdr->uint32Magic, USBISS_LOG_MAGIC, __ATOMIC_RELEASE);
+    }
+    /* time pair for wall clock conversion of this writer run */
+    self->uint64MonoUs = usbiss_log_time_us(CLOCK_MONOTONIC);
+    self->uint64RealUs = usbiss_log_time_us(CLOCK_REALTIME);
+    hdr->uint64MonoUs = self->uint64MonoUs;
+    hdr->uint64RealUs = self->uint64RealUs;
+    self->hdr = hdr;
+    self->rec = (t_usbiss_log_rec*) (hdr + 1);
+    self->size = size;
+    self->uint8Writer = 1;
+    self->uint64Seq = hdr->uint64Seq;
+    return 0;
+#else
+    (void) self;
+    (void) path;
+    (void) slots;
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_log_attach
+ *    opens ring file read only
+ */
+int usbiss_log_attach( t_usbiss_log *self, const char* path, uint8_t tail )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    struct stat         st;     // file size
+    t_usbiss_log_hdr*   hdr;    // mapped file
+    uint64_t            head;   // written records
+    int                 fd;     // ring file
+
+    /* init */
+    memset(self, 0, sizeof(*self));
+    /* map */
+    fd = open(path, O_RDONLY);
+    if ( 0 > fd ) {
+        return -1;
+    }
+    if ( (0 != fstat(fd, &st)) || ((size_t) st.st_size < sizeof(t_usbiss_log_hdr)) ) {
+        close(fd);
+        return -1;
+    }
+    hdr = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if ( MAP_FAILED == hdr ) {
+        return -1;
+    }
+    /* layout */
+    if ( (USBISS_LOG_MAGIC != __atomic_load_n(&hdr->uint32Magic, __ATOMIC_ACQUIRE)) || (USBISS_LOG_VERSION != hdr->uint16Version) || (sizeof(t_usbiss_log_rec) != hdr->uint16RecSize) || (0 == hdr->uint32Slots) ||
+         ((size_t) st.st_size != sizeof(t_usbiss_log_hdr) + (size_t) hdr->uint32Slots * sizeof(t_usbiss_log_rec)) ) {
+        munmap(hdr, (size_t) st.st_size);
+        return -1;
+    }
+    self->hdr = hdr;
+    self->rec = (t_usbiss_log_rec*) (hdr + 1);
+    self->size = (size_t) st.st_size;
+    /* start */
+    head = __atomic_load_n(&hdr->uint64Seq, __ATOMIC_ACQUIRE);
+    if ( 0 != tail ) {
+        self->uint64Seq = head;
+    } else {
+        self->uint64Seq = (head > hdr->uint32Slots) ? head - hdr->uint32Slots : 0;
+    }
+    return 0;
+#else
+    (void) self;
+    (void) path;
+    (void) tail;
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_log_put
+ *    appends sample
+ */
+int usbiss_log_put( t_usbiss_log *self, uint64_t us, uint8_t adr7, uint32_t reg, const void* data, size_t len, int intRet )
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    t_usbiss_log_rec*   rec;    // record slot
+    uint64_t            seq;    // record number
+
+    if ( (NULL == self->hdr) || (0 == self->uint8Writer) ) {
+        return -1;
+    }
+    len = (len < USBISS_LOG_DATA) ? len : USBISS_LOG_DATA;
+    seq = self->hdr->uint64Seq;
+    rec = &self->rec[seq % self->hdr->uint32Slots];
+    /* invalidate slot, readers detect overwrite by changed sequence */
+    __atomic_store_n(&rec->uint64Seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    rec->uint64Us = (0 != us) ? us : usbiss_log_time_us(CLOCK_MONOTONIC);
+    rec->uint64RealUs = self->uint64RealUs + rec->uint64Us - self->uint64MonoUs;   // modulo arithmetic, samples before writer start
+    rec->uint32Reg = reg;
+    rec->int32Ret = (int32_t) intRet;
+    rec->uint8Adr7 = adr7;
+    rec->uint8Len = (uint8_t) len;
+    if ( 0 != len ) {
+        memcpy(rec->data, data, len);
+    }
+    memset(rec->data + len, 0, USBISS_LOG_DATA - len);
+    /* publish */
+    __atomic_store_n(&rec->uint64Seq, seq + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&self->hdr->uint64Seq, seq + 1, __ATOMIC_RELEASE);
+    return 0;
+#else
+    (void) self;
+    (void) us;
+    (void) adr7;
+    (void) reg;
+    (void) data;
+    (void) len;
+    (void) intRet;
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_log_get
+ *    reads next record
+ */
+int usbiss_log_get( t_usbiss_log *self, t_usbiss_log_rec *rec )
+{
+    /** Variables **/
+    const t_usbiss_log_rec* slot;   // record slot
+    uint64_t                head;   // written records
+    uint64_t                seq;    // sequence of slot before copy
+    uint32_t                slots;  // records in ring
+
+    if ( NULL == self->hdr ) {
+        return -1;
+    }
+    slots = self->hdr->uint32Slots;
+    for ( ;; ) {
+        head = __atomic_load_n(&self->hdr->uint64Seq, __ATOMIC_ACQUIRE);
+        if ( !(self->uint64Seq < head) ) {
+            return 1;   // caught up
+        }
+        /* reader lapped, continue with oldest record */
+        if ( head - self->uint64Seq > slots ) {
+            self->uint64Lost += head - slots - self->uint64Seq;
+            self->uint64Seq = head - slots;
+        }
+        /* sequence lock */
+        slot = &self->rec[self->uint64Seq % slots];
+        seq = __atomic_load_n(&slot->uint64Seq, __ATOMIC_ACQUIRE);
+        memcpy(rec, (const void*) slot, sizeof(*rec));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if ( (seq == self->uint64Seq + 1) && (seq == __atomic_load_n(&slot->uint64Seq, __ATOMIC_RELAXED)) ) {
+            rec->uint64Seq = seq;
+            ++(self->uint64Seq);
+            return 0;
+        }
+        /* overwritten during copy */
+        ++(self->uint64Lost);
+        ++(self->uint64Seq);
+    }
+}
+
+
+
+/**
+ *  usbiss_log_csv
+ *    exports ring file as CSV
+ */
+int usbiss_log_csv( const char* path, FILE* fh )
+{
+    /** Variables **/
+    t_usbiss_log        log;        // ring file
+    t_usbiss_log_rec    rec;        // current record
+    int                 num = 0;    // exported records
+
+    if ( 0 != usbiss_log_attach(&log, path, 0) ) {
+        return -1;
+    }
+    fprintf(fh, "seq,mono_us,unix_us,adr7,reg,status,data\n");
+    while ( 0 == usbiss_log_get(&log, &rec) ) {
+        fprintf(fh, "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",0x%02x,0x%x,%" PRIi32 ",", rec.uint64Seq - 1, rec.uint64Us, rec.uint64RealUs, rec.uint8Adr7, rec.uint32Reg, rec.int32Ret);
+        for ( uint8_t i = 0; i < rec.uint8Len; i++ ) {
+            fprintf(fh, "%02x", rec.data[i]);
+        }
+        fprintf(fh, "\n");
+        ++num;
+    }
+    usbiss_log_close(&log);
+    return num;
+}
+
+
+
+/**
+ *  usbiss_log_close
+ *    unmaps ring file
+ */
+int usbiss_log_close( t_usbiss_log *self )
+{
+#if !defined(_WIN32)
+    if ( NULL != self->hdr ) {
+        munmap(self->hdr, self->size);
+    }
+#endif
+    self->hdr = NULL;
+    self->rec = NULL;
+    return 0;
+}
@@ -0,0 +1,250 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_log.h
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS capture ring file
+                  logs timestamped samples into a memory mapped file:
+                    * fixed size binary records, bounded file size
+                    * one writer, lock free tailing readers
+                    * ring continues after writer restart
+                    * offline CSV export
+***********************************************************************/
+
+
+
+// Define Guard
+#ifndef __USB_ISS_LOG_H
+#define __USB_ISS_LOG_H
+
+
+/** Includes **/
+#include <stddef.h>     // size_t
+#include <stdint.h>     // defines fixed data types, like int8_t...
+#include <stdio.h>      // FILE
+
+
+
+/**
+ *  @defgroup USBISS_LOG
+ *  Capture ring file
+ *
+ *  @{
+ */
+#define USBISS_LOG_MAGIC        (0x474c5355)    /**< 'USLG', ring file initialized */
+#define USBISS_LOG_VERSION      (2)             /**< record layout version */
+#define USBISS_LOG_DATA         (20)            /**< maximum data bytes per record, longer data is truncated */
+#define USBISS_LOG_SLOTS        (65536)         /**< default number of records */
+/** @} */   // USBISS_LOG
+
+
+
+/**
+ *  @typedef t_usbiss_log_hdr
+ *
+ *  @brief  ring file header
+ *
+ *  first 64 bytes of file, host byte order
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_log_hdr {
+    uint32_t    uint32Magic;        /**<  #USBISS_LOG_MAGIC, written last on init */
+    uint16_t    uint16Version;      /**<  #USBISS_LOG_VERSION */
+    uint16_t    uint16RecSize;      /**<  size of one record in bytes */
+    uint32_t    uint32Slots;        /**<  number of records in ring */
+    uint32_t    uint32Rsv;          /**<  reserved */
+    uint64_t    uint64Seq;          /**<  number of written records, record n is in slot n % uint32Slots */
+    uint64_t    uint64MonoUs;       /**<  monotonic time at last writer start in us */
+    uint64_t    uint64RealUs;       /**<  wall clock at last writer start in us since 1970 */
+    uint8_t     uint8Rsv[24];       /**<  reserved */
+} t_usbiss_log_hdr;
+
+
+
+/**
+ *  @typedef t_usbiss_log_rec
+ *
+ *  @brief  sample record
+ *
+ *  56 bytes behind header, host byte order
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_log_rec {
+    uint64_t    uint64Seq;                  /**<  record number + 1, 0: record is written */
+    uint64_t    uint64Us;                   /**<  monotonic timestamp in us */
+    uint64_t    uint64RealUs;               /**<  wall clock of timestamp in us since 1970, from time pair of writer */
+    uint32_t    uint32Reg;                  /**<  register address */
+    int32_t     int32Ret;                   /**<  transfer result, see #usbiss_i2c_xfer */
+    uint8_t     uint8Adr7;                  /**<  Seven Bit I2C address */
+    uint8_t     uint8Len;                   /**<  number of valid bytes in data */
+    uint8_t     uint8Rsv[2];                /**<  reserved */
+    uint8_t     data[USBISS_LOG_DATA];      /**<  sample data */
+} t_usbiss_log_rec;
+
+
+
+/**
+ *  @typedef t_usbiss_log
+ *
+ *  @brief  process local handle
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_log {
+    t_usbiss_log_hdr*   hdr;            /**<  mapped file, NULL: closed */
+    t_usbiss_log_rec*   rec;            /**<  records behind header */
+    size_t              size;           /**<  mapped bytes */
+    uint8_t             uint8Writer;    /**<  1: opened by #usbiss_log_create */
+    uint64_t            uint64MonoUs;   /**<  writer: monotonic time at start in us */
+    uint64_t            uint64RealUs;   /**<  writer: wall clock at start in us since 1970 */
+    uint64_t            uint64Seq;      /**<  reader: next record */
+    uint64_t            uint64Lost;     /**<  reader: records overwritten before read */
+} t_usbiss_log;
+
+
+
+/**
+ *  @brief C++ Guard
+ *
+ *  Make usable with C++ compiler
+ *
+ *  @see https://stackoverflow.com/questions/14997165/how-to-call-c-function-from-c
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+
+
+/**
+ *  @brief create
+ *
+ *  opens ring file for writing. An existing ring file with the same number
+ *  of records is continued, otherwise the file is initialized. Only one
+ *  writer per file.
+ *
+ *  @param[in,out]  self                log handle
+ *  @param[in]      path                ring file
+ *  @param[in]      slots               number of records, 0: #USBISS_LOG_SLOTS
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_log_create( t_usbiss_log *self, const char* path, uint32_t slots );
+
+
+
+/**
+ *  @brief attach
+ *
+ *  opens ring file read only, can be used while the writer is running
+ *
+ *  @param[in,out]  self                log handle
+ *  @param[in]      path                ring file
+ *  @param[in]      tail                0: starts with oldest record, 1: only new records
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_log_attach( t_usbiss_log *self, const char* path, uint8_t tail );
+
+
+
+/**
+ *  @brief put
+ *
+ *  appends sample, overwrites oldest record if ring is full
+ *
+ *  @param[in,out]  self                log handle of writer
+ *  @param[in]      us                  monotonic timestamp in us, 0: now
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      reg                 register address
+ *  @param[in]      data                sample data
+ *  @param[in]      len                 number of bytes in data, truncated to #USBISS_LOG_DATA
+ *  @param[in]      intRet              transfer result
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, not opened for writing
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_log_put( t_usbiss_log *self, uint64_t us, uint8_t adr7, uint32_t reg, const void* data, size_t len, int intRet );
+
+
+
+/**
+ *  @brief get
+ *
+ *  reads next record. Records overwritten by the writer before they were
+ *  read are skipped and counted in uint64Lost.
+ *
+ *  @param[in,out]  self                log handle
+ *  @param[out]     rec                 record
+ *  @return         int
+ *  @retval         0                   record read
+ *  @retval         1                   no new record
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_log_get( t_usbiss_log *self, t_usbiss_log_rec *rec );
+
+
+
+/**
+ *  @brief CSV export
+ *
+ *  writes all records of ring file in order as CSV, wall clock is taken
+ *  from the record, so records of earlier writer runs keep their time
+ *
+ *  @param[in]      path                ring file
+ *  @param[in,out]  fh                  CSV output, f.e. stdout
+ *  @return         int
+ *  @retval         >=0                 number of exported records
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_log_csv( const char* path, FILE* fh );
+
+
+
+/**
+ *  @brief close
+ *
+ *  unmaps ring file
+ *
+ *  @param[in,out]  self                log handle
+ *  @return         int
+ *  @retval         0                   OK
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_log_close( t_usbiss_log *self );
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+
+#endif // __USB_ISS_LOG_H
@@ -22,14 +22,25 @@
 /** Standard libs **/
 #include <errno.h>          // number of last error
 #include <getopt.h>         // CLI parser
+#include <signal.h>         // stop daemon
 #include <stdint.h>         // int8_t, ...
 #include <stdio.h>          // standard input/output
 #include <stdlib.h>
 #include <string.h>         // string manipulation
 #include <unistd.h>         // fwrite/fread/getuid
+#if !defined(_WIN32)
+    #include <poll.h>       // script input pending
+    #include <sys/stat.h>   // script input type
+    #include <time.h>       // clock_gettime
+#else
+    #include <windows.h>    // QueryPerformanceCounter
+#endif
 /** Custom Libs **/
 #include "simple_uart.h"    // cross platform UART driver
 #include "usbiss.h"         // USBISS driver
+#include "usbiss_ipc.h"     // USBISS daemon
+#include "usbiss_eeprom.h"  // serial EEPROM
+#include "usbiss_log.h"     // capture ring file
 
 
 
@@ -45,6 +56,45 @@
 
 
 
+/**
+ *  @defgroup SCRIPT
+ *  Script mode
+ *  @{
+ */
+#define SCRIPT_BATCH            64          /**< maximum number of consecutive transfers executed as batch */
+#define SCRIPT_LINE             1024        /**< maximum length of script line */
+/** @} */   // SCRIPT
+
+
+
+/**
+ *  @defgroup POLL
+ *  Poll mode
+ *  @{
+ */
+#define POLL_INTERVAL_US        1000000     /**< default poll interval */
+#define POLL_WIN                65536       /**< number of latest samples for percentile */
+#define POLL_REPORT_US          1000000     /**< interval of rolling statistics */
+/** @} */   // POLL
+
+
+
+/**
+ *  @defgroup EEPROM
+ *  EEPROM dump and program
+ *  @{
+ */
+#define EEPROM_GEO              "2:32"      /**< default word address bytes and page size, 24C32/24C64 */
+#define EEPROM_MAX_DEV          8           /**< maximum number of EEPROMs programmed interleaved */
+#define EEPROM_MIS_PRINT        32          /**< verify prints up to this number of mismatch ranges */
+#define EEPROM_DUMP             0           /**< read EEPROM into file */
+#define EEPROM_PROGRAM          1           /**< write file into EEPROM */
+#define EEPROM_DIFF             2           /**< write changed pages of file into EEPROM */
+#define EEPROM_VERIFY           3           /**< compare EEPROM with file */
+/** @} */   // EEPROM
+
+
+
 /**
  *  @defgroup GIT
  *  git related defintion
@@ -57,6 +107,32 @@
 
 
 
+/**
+ *  @brief daemon stop request
+ *
+ *  set by SIGINT/SIGTERM, ends #usbiss_ipc_serve
+ */
+static volatile sig_atomic_t g_sigStop = 0;
+
+
+
+/**
+ *  @brief stop daemon
+ *
+ *  signal handler, requests end of daemon
+ *
+ *  @param[in]      sig             signal number
+ *  @return         void
+ *  @since          October 18, 2026
+ */
+static void usbiss_term_stop (int sig)
+{
+    (void) sig;
+    g_sigStop = 1;
+}
+
+
+
 /**
  *  @brief print hexdump
  *
@@ -312,8 +388,8 @@ static int process_cmd (char *str, uint8_t *adr, uint8_t **data, uint32_t *wrLen
         ++i;
         ptr = strtok(NULL, " ");
     }
-    /* allocate memory according array dimensions */
-    *data = malloc(usbiss_max(*wrLen, *rdLen));
+    /* allocate memory according array dimensions, write-read stores read data behind write data */
+    *data = malloc(usbiss_max(*wrLen + *rdLen, (uint32_t) 1));
     if ( *wrLen > 0 ) {
         /* reset write counter */
         *wrLen = 0;
@@ -349,6 +425,909 @@ static int process_cmd (char *str, uint8_t *adr, uint8_t **data, uint32_t *wrLen
 
 
 
+/**
+ *  @brief process route
+ *
+ *  splits multiplexer route '<mux>/<channel>/<adr7>' of command, route
+ *  prefix is blanked for #process_cmd
+ *
+ *  @param[in,out]  str             command
+ *  @param[out]     mux             multiplexer address, #USBISS_I2C_MUX_ROOT: no route
+ *  @param[out]     channel         multiplexer channel
+ *  @return         int             0: OK, 1: incomplete route
+ *  @since          October 18, 2026
+ */
+static int process_route (char *str, uint8_t *mux, uint8_t *channel)
+{
+    /** Variables **/
+    char    *end;       // end of address token
+    char    *first;     // separator behind multiplexer
+    char    *second;    // separator behind channel
+
+    /* root bus */
+    *mux = USBISS_I2C_MUX_ROOT;
+    *channel = 0;
+    /* address token */
+    str += strspn(str, " ");
+    end = str + strcspn(str, " ");
+    first = strchr(str, '/');
+    if ( (NULL == first) || (first > end) ) {
+        return 0;
+    }
+    second = strchr(first+1, '/');
+    if ( (NULL == second) || (second > end) ) {
+        return 1;
+    }
+    *mux = (uint8_t) to_int(str);
+    *channel = (uint8_t) to_int(first+1);
+    memset(str, ' ', (size_t) (second - str + 1));
+    return 0;
+}
+
+
+
+/**
+ *  @brief print transfer
+ *
+ *  prints result of I2C transfer
+ *
+ *  @param[in]      msgLevel        message level, #MSG_LEVEL
+ *  @param[in]      xfer            executed transfer
+ *  @param[in]      line            script line of transfer
+ *  @return         void
+ *  @since          October 18, 2026
+ */
+static void print_xfer (int msgLevel, t_usbiss_i2c_xfer *xfer, uint32_t line)
+{
+    /** Variables **/
+    char    charHex[3*USBISS_I2C_NUM_ADR+1];    // brief read data
+
+    /* failed */
+    if ( 0 != xfer->intRet ) {
+        if ( MSG_LEVEL_NORM <= msgLevel ) {
+            printf("[ FAIL ]   line %u: Write %zu and Read %zu bytes from device 0x%02x, ero=%i\n", line, xfer->wrLen, xfer->rdLen, xfer->uint8Adr7, xfer->intRet);
+        }
+        return;
+    }
+    /* brief, only read data */
+    if ( MSG_LEVEL_NORM > msgLevel ) {
+        for ( size_t i = 0; i < xfer->rdLen; i += USBISS_I2C_NUM_ADR ) {
+            sprint_hex(charHex, (uint8_t*) xfer->rd + i, usbiss_min(xfer->rdLen - i, (size_t) USBISS_I2C_NUM_ADR));
+            printf("%s%s", (0 != i) ? " " : "", charHex);
+        }
+        if ( 0 != xfer->rdLen ) {
+            printf("\n");
+        }
+        return;
+    }
+    /* normal */
+    if ( 0 == xfer->rdLen ) {
+        printf("[ OKAY ]   Write %zu bytes to device 0x%02x\n", xfer->wrLen, xfer->uint8Adr7);
+        print_hexdump("             ", xfer->wr, xfer->wrLen);
+    } else if ( 0 == xfer->wrLen ) {
+        printf("[ OKAY ]   Read %zu bytes from device 0x%02x\n", xfer->rdLen, xfer->uint8Adr7);
+        print_hexdump("             ", xfer->rd, xfer->rdLen);
+    } else {
+        printf("[ OKAY ]   Write/Read interaction with device 0x%02x\n", xfer->uint8Adr7);
+        printf("           Write %zu Bytes\n", xfer->wrLen);
+        print_hexdump("             ", xfer->wr, xfer->wrLen);
+        printf("           Read %zu Bytes\n", xfer->rdLen);
+        print_hexdump("             ", xfer->rd, xfer->rdLen);
+    }
+}
+
+
+
+/**
+ *  @brief script more input
+ *
+ *  checks if further script lines are pending without blocking,
+ *  consecutive transfers are only batched if the next line is available.
+ *  Input from pipes and terminals is unbuffered, see #script_unbuf, so
+ *  that no line hides in the stdio buffer
+ *
+ *  @param[in]      fh              script file handle
+ *  @return         int             1: input pending
+ *  @since          October 18, 2026
+ */
+static int script_more (FILE *fh)
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    struct pollfd   pfd;
+
+    pfd.fd = fileno(fh);
+    pfd.events = POLLIN;
+    return (1 == poll(&pfd, 1, 0)) ? 1 : 0;
+#else
+    return (stdin != fh) ? 1 : 0;
+#endif
+}
+
+
+
+/**
+ *  @brief script unbuffered
+ *
+ *  disables stdio buffering of script input from pipes and terminals,
+ *  otherwise lines already read into the stdio buffer are invisible to
+ *  #script_more. Regular files are always pending and keep buffering.
+ *
+ *  @param[in,out]  fh              script file handle
+ *  @since          October 18, 2026
+ */
+static void script_unbuf (FILE *fh)
+{
+#if !defined(_WIN32)
+    /** Variables **/
+    struct stat st;
+
+    if ( (0 == fstat(fileno(fh), &st)) && !S_ISREG(st.st_mode) ) {
+        setvbuf(fh, NULL, _IONBF, 0);
+    }
+#else
+    (void) fh;
+#endif
+}
+
+
+
+/**
+ *  @brief script batch
+ *
+ *  executes batched script transfers, prints the results and releases the
+ *  transfer buffers
+ *
+ *  @param[in,out]  usbiss          opened USB-ISS
+ *  @param[in,out]  xfer            batched transfers
+ *  @param[in]      line            script line of transfer
+ *  @param[in]      num             number of batched transfers
+ *  @param[in]      msgLevel        message level, #MSG_LEVEL
+ *  @return         int             0: OK, -1: FAIL
+ *  @since          October 18, 2026
+ */
+static int script_batch (t_usbiss *usbiss, t_usbiss_i2c_xfer *xfer, const uint32_t *line, size_t num, int msgLevel)
+{
+    /** Variables **/
+    int     intRet = 0;     // batch result
+
+    if ( 0 == num ) {
+        return 0;
+    }
+    if ( 0 != usbiss_i2c_xfer_batch(usbiss, xfer, num) ) {
+        intRet = -1;
+    }
+    for ( size_t i = 0; i < num; i++ ) {
+        print_xfer(msgLevel, &xfer[i], line[i]);
+        free(xfer[i].wr);
+        free(xfer[i].rd);
+    }
+    fflush(stdout);     // stream results
+    return intRet;
+}
+
+
+
+/**
+ *  @brief run script
+ *
+ *  executes script over one open USB-ISS session. Lines are
+ *    <adr7> w <b0> <bn> r <cnt>    : I2C transfer, see option '-c'
+ *    mode <mode>                   : change transfer mode
+ *    delay <us>                    : wait
+ *    scan [start:stop]             : scan I2C bus
+ *    # comment
+ *  Consecutive transfers with the same I2C clock are executed as
+ *  #usbiss_i2c_xfer_batch, so lines run in order, results are printed after
+ *  every batch. The script stops after the batch with the first failing
+ *  command, transfers of lines before an invalid line are executed.
+ *
+ *  @param[in,out]  usbiss          opened USB-ISS
+ *  @param[in]      path            script file, '-' for stdin
+ *  @param[in]      msgLevel        message level, #MSG_LEVEL
+ *  @return         int             0: OK, -1: FAIL
+ *  @since          October 18, 2026
+ */
+static int run_script (t_usbiss *usbiss, const char *path, int msgLevel)
+{
+    /** Variables **/
+    FILE*               fh;                         // script handle
+    char                charLine[SCRIPT_LINE];      // script line
+    char                charTok[32];                // first token
+    char*               charPtrLine;                // line without leading blanks
+    t_usbiss_i2c_xfer   xfer[SCRIPT_BATCH];         // batched transfers
+    uint32_t            uint32XferLine[SCRIPT_BATCH];   // script line of transfer
+    uint8_t*            uint8PtrData;               // write data
+    uint8_t*            uint8PtrRd;                 // read data
+    uint32_t            uint32WrLen;                // number of write bytes
+    uint32_t            uint32RdLen;                // number of read bytes
+    uint8_t             uint8Adr;                   // I2C address
+    int8_t              int8I2cDevices[USBISS_I2C_NUM_ADR]; // found I2C devices
+    char*               charPtrBuf;                 // scan print
+    unsigned int        uintStart, uintStop;        // scan range
+    size_t              num = 0;                    // number of batched transfers
+    uint32_t            line = 0;                   // current line
+    int                 intRet = 0;                 // script result
+    int                 intCmd;                     // command result
+
+    /* open */
+    fh = (0 == strcmp(path, "-")) ? stdin : fopen(path, "r");
+    if ( NULL == fh ) {
+        printf("[ FAIL ]   open script '%s'\n", path);
+        return -1;
+    }
+    script_unbuf(fh);
+    /* process lines */
+    while ( 0 == intRet ) {
+        /* execute batch before non transfer, at end or if no further input is pending */
+        charPtrLine = NULL;
+        if ( (num < SCRIPT_BATCH) && ((0 == num) || (0 != script_more(fh))) ) {
+            charPtrLine = fgets(charLine, sizeof(charLine), fh);
+            if ( NULL != charPtrLine ) {
+                ++line;
+                charLine[strcspn(charLine, "#\r\n")] = '\0';   // strip comment
+                charPtrLine += strspn(charPtrLine, " \t");
+                if ( '\0' == charPtrLine[0] ) {
+                    continue;
+                }
+                charTok[0] = '\0';
+                sscanf(charPtrLine, "%31s", charTok);
+            }
+        }
+        if ( (0 != num) && ((NULL == charPtrLine) || (0 == strcmp(charTok, "mode")) || (0 == strcmp(charTok, "delay")) || (0 == strcmp(charTok, "scan"))) ) {
+            intRet = script_batch(usbiss, xfer, uint32XferLine, num, msgLevel);
+            num = 0;
+            if ( 0 != intRet ) {
+                break;
+            }
+        }
+        if ( NULL == charPtrLine ) {
+            if ( feof(fh) || ferror(fh) ) {
+                break;
+            }
+            continue;   // batch full or input stalled
+        }
+        /* mode */
+        if ( 0 == strcmp(charTok, "mode") ) {
+            intCmd = (1 == sscanf(charPtrLine, "%*s %31s", charTok)) ? usbiss_set_mode(usbiss, charTok) : -1;
+            if ( MSG_LEVEL_NORM <= msgLevel ) {
+                printf("[ %s ]   line %u: Mode %s\n", (0 == intCmd) ? "OKAY" : "FAIL", line, usbiss_mode_to_human(usbiss->uint8Mode));
+            }
+            intRet = intCmd;
+        /* delay */
+        } else if ( 0 == strcmp(charTok, "delay") ) {
+            if ( 1 != sscanf(charPtrLine, "%*s %31s", charTok) ) {
+                printf("[ FAIL ]   line %u: delay requires time in us\n", line);
+                intRet = -1;
+            } else {
+                fflush(stdout);
+                usleep((useconds_t) to_int(charTok));
+            }
+        /* scan */
+        } else if ( 0 == strcmp(charTok, "scan") ) {
+            uintStart = 0x03;
+            uintStop = 0x77;
+            if ( 1 == sscanf(charPtrLine, "%*s %31s", charTok) ) {
+                charPtrBuf = strchr(charTok, ':');
+                if ( NULL != charPtrBuf ) {
+                    *charPtrBuf = '\0';
+                    uintStop = (unsigned int) to_int(charPtrBuf + 1) & 0x7f;
+                }
+                uintStart = (unsigned int) to_int(charTok) & 0x7f;
+            }
+            intCmd = usbiss_i2c_scan(usbiss, (int8_t) uintStart, (int8_t) uintStop, int8I2cDevices, sizeof(int8I2cDevices));
+            charPtrBuf = malloc(1024);
+            if ( (0 > intCmd) || (NULL == charPtrBuf) ) {
+                printf("[ FAIL ]   line %u: Scan I2C bus in range 0x%0x:0x%0x\n", line, uintStart, uintStop);
+                intRet = -1;
+            } else {
+                if ( MSG_LEVEL_NORM <= msgLevel ) {
+                    printf("[ OKAY ]   Scan I2C bus in range 0x%0x:0x%0x\n", uintStart, uintStop);
+                }
+                sprint_i2c_adr((MSG_LEVEL_NORM <= msgLevel) ? "             " : "", charPtrBuf, 1024, (int8_t) uintStart, (int8_t) uintStop, int8I2cDevices, (uint8_t) intCmd);
+                printf("%s", charPtrBuf);
+            }
+            free(charPtrBuf);
+        /* transfer */
+        } else {
+            uint8PtrData = NULL;
+            intCmd = process_cmd(charPtrLine, &uint8Adr, &uint8PtrData, &uint32WrLen, &uint32RdLen);
+            if ( (0 != intCmd) || (0 == (uint32WrLen + uint32RdLen)) || (0x7f < uint8Adr) ) {
+                script_batch(usbiss, xfer, uint32XferLine, num, msgLevel);  // lines before run and report
+                num = 0;
+                printf("[ FAIL ]   line %u: unsupported command '%s'\n", line, charPtrLine);
+                free(uint8PtrData);
+                intRet = -1;
+                break;
+            }
+            uint8PtrRd = malloc(usbiss_max(uint32RdLen, (uint32_t) 1));
+            if ( NULL == uint8PtrRd ) {
+                script_batch(usbiss, xfer, uint32XferLine, num, msgLevel);
+                num = 0;
+                printf("[ FAIL ]   line %u: allocate %u read bytes\n", line, uint32RdLen);
+                free(uint8PtrData);
+                intRet = -1;
+                break;
+            }
+            /* clock change, keeps line order */
+            if ( (0 != num) && (usbiss_i2c_get_clk(usbiss, xfer[0].uint8Adr7) != usbiss_i2c_get_clk(usbiss, uint8Adr)) ) {
+                intRet = script_batch(usbiss, xfer, uint32XferLine, num, msgLevel);
+                num = 0;
+                if ( 0 != intRet ) {
+                    free(uint8PtrData);
+                    free(uint8PtrRd);
+                    break;
+                }
+            }
+            xfer[num].uint8Adr7 = uint8Adr;
+            xfer[num].wr = uint8PtrData;
+            xfer[num].wrLen = uint32WrLen;
+            xfer[num].rd = uint8PtrRd;
+            xfer[num].rdLen = uint32RdLen;
+            uint32XferLine[num] = line;
+            ++num;
+        }
+        fflush(stdout);
+    }
+    /* clean-up */
+    for ( size_t i = 0; i < num; i++ ) {
+        free(xfer[i].wr);
+        free(xfer[i].rd);
+    }
+    if ( stdin != fh ) {
+        fclose(fh);
+    }
+    return intRet;
+}
+
+
+
+/**
+ *  @brief monotonic time
+ *
+ *  @return         uint64_t        time in us
+ *  @since          October 18, 2026
+ */
+static uint64_t time_us (void)
+{
+#if defined(_WIN32)
+    /** Variables **/
+    LARGE_INTEGER   cnt, frq;
+
+    QueryPerformanceCounter(&cnt);
+    QueryPerformanceFrequency(&frq);
+    return (uint64_t) ((cnt.QuadPart / frq.QuadPart) * 1000000 + ((cnt.QuadPart % frq.QuadPart) * 1000000) / frq.QuadPart);
+#else
+    /** Variables **/
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) ts.tv_nsec / 1000;
+#endif
+}
+
+
+
+/**
+ *  @brief compare latency
+ *
+ *  qsort helper
+ *
+ *  @since          October 18, 2026
+ */
+static int cmp_uint32 (const void *a, const void *b)
+{
+    return (*(const uint32_t*) a > *(const uint32_t*) b) - (*(const uint32_t*) a < *(const uint32_t*) b);
+}
+
+
+
+/**
+ *  @brief latency statistic
+ *
+ *  min/avg/max and 99th percentile over the window of latest samples
+ *
+ *  @param[in]      smp             latency samples
+ *  @param[in]      num             number of samples
+ *  @param[in,out]  tmp             sort buffer, num elements
+ *  @param[out]     stat            min, avg, max, p99; zero without samples
+ *  @since          October 18, 2026
+ */
+static void poll_stat (const uint32_t *smp, size_t num, uint32_t *tmp, uint32_t stat[4])
+{
+    /** Variables **/
+    uint64_t    uint64Sum = 0;  // latency sum
+
+    memset(stat, 0, 4 * sizeof(uint32_t));
+    if ( 0 == num ) {
+        return;
+    }
+    memcpy(tmp, smp, num * sizeof(uint32_t));
+    qsort(tmp, num, sizeof(uint32_t), cmp_uint32);
+    for ( size_t i = 0; i < num; i++ ) {
+        uint64Sum += tmp[i];
+    }
+    stat[0] = tmp[0];
+    stat[1] = (uint32_t) (uint64Sum / num);
+    stat[2] = tmp[num - 1];
+    stat[3] = tmp[((num * 99) + 99) / 100 - 1];
+}
+
+
+
+/**
+ *  @brief run poll
+ *
+ *  repeats I2C transfer at fixed rate and reports latency like ping.
+ *  A stalled schedule restarts from now instead of bursting to catch up,
+ *  latency statistic covers the latest #POLL_WIN good transfers
+ *
+ *  @param[in,out]  usbiss          opened USB-ISS
+ *  @param[in,out]  xfer            transfer to repeat
+ *  @param[in]      count           number of transfers, 0: until SIGINT
+ *  @param[in]      interval        transfer interval in us
+ *  @param[in,out]  log             capture ring, NULL: no capture
+ *  @param[in]      msgLevel        message level, #MSG_LEVEL
+ *  @return         int             0: all transfers OK, -1: errors
+ *  @since          October 18, 2026
+ */
+static int run_poll (t_usbiss *usbiss, t_usbiss_i2c_xfer *xfer, uint32_t count, uint32_t interval, t_usbiss_log *log, int msgLevel)
+{
+    /** Variables **/
+    uint32_t*   uint32PtrSmp;           // latency window
+    uint32_t*   uint32PtrTmp;           // sort buffer
+    uint8_t*    uint8PtrWr;             // write data, restored per transfer
+    uint64_t    uint64Start;            // poll start
+    uint64_t    uint64Next;             // next transfer
+    uint64_t    uint64Report;           // next rolling statistic
+    uint64_t    uint64Now;              // current time
+    uint32_t    uint32Lat;              // latency of transfer
+    uint32_t    uint32Stat[4];          // min/avg/max/p99 of window
+    uint32_t    uint32Num = 0;          // executed transfers
+    uint32_t    uint32Ok = 0;           // good transfers
+    uint32_t    uint32Nack = 0;         // not acknowledged transfers
+    uint32_t    uint32Late = 0;         // transfers behind schedule
+    uint32_t    uint32Reg = 0;          // register of capture, write data as big endian
+    size_t      num = 0;                // samples in window
+
+    /* alloc */
+    uint32PtrSmp = malloc(POLL_WIN * sizeof(uint32_t));
+    uint32PtrTmp = malloc(POLL_WIN * sizeof(uint32_t));
+    uint8PtrWr = malloc(usbiss_max(xfer->wrLen, (size_t) 1));
+    if ( (NULL == uint32PtrSmp) || (NULL == uint32PtrTmp) || (NULL == uint8PtrWr) ) {
+        printf("[ FAIL ]   memory allocation\n");
+        free(uint32PtrSmp);
+        free(uint32PtrTmp);
+        free(uint8PtrWr);
+        return -1;
+    }
+    if ( 0 != xfer->wrLen ) {
+        memcpy(uint8PtrWr, xfer->wr, xfer->wrLen);
+    }
+    for ( size_t i = 0; (i < xfer->wrLen) && (i < sizeof(uint32Reg)); i++ ) {
+        uint32Reg = (uint32Reg << 8) | uint8PtrWr[i];
+    }
+    /* stop on SIGINT, summary follows */
+    signal(SIGINT, usbiss_term_stop);
+    if ( MSG_LEVEL_NORM <= msgLevel ) {
+        printf("[ INFO ]   Poll device 0x%02x, write %zu read %zu bytes, interval %u us\n", xfer->uint8Adr7, xfer->wrLen, xfer->rdLen, interval);
+    }
+    uint64Start = time_us();
+    uint64Next = uint64Start;
+    uint64Report = uint64Start + POLL_REPORT_US;
+    while ( ((0 == count) || (uint32Num < count)) && (0 == g_sigStop) ) {
+        /* fixed rate */
+        uint64Now = time_us();
+        if ( uint64Now < uint64Next ) {
+            usleep((useconds_t) (uint64Next - uint64Now));
+        } else if ( uint64Now > uint64Next + interval ) {
+            ++uint32Late;
+            uint64Next = uint64Now;     // resync after stall
+        }
+        uint64Next += interval;
+        /* transfer */
+        memcpy(xfer->wr, uint8PtrWr, xfer->wrLen);
+        uint64Now = time_us();
+        usbiss_i2c_xfer(usbiss, xfer);
+        uint32Lat = (uint32_t) (time_us() - uint64Now);
+        ++uint32Num;
+        if ( NULL != log ) {
+            usbiss_log_put(log, uint64Now, xfer->uint8Adr7, uint32Reg, xfer->rd, (0 == xfer->intRet) ? xfer->rdLen : 0, xfer->intRet);
+        }
+        if ( 0 == xfer->intRet ) {
+            ++uint32Ok;
+            uint32PtrSmp[(uint32Ok - 1) % POLL_WIN] = uint32Lat;
+            num = usbiss_min((size_t) uint32Ok, (size_t) POLL_WIN);
+        } else {
+            uint32Nack += (USBISS_ERO_ID1 == xfer->intRet) ? 1 : 0;
+            if ( MSG_LEVEL_NORM <= msgLevel ) {
+                printf("           seq=%u error ero=%i\n", uint32Num, xfer->intRet);
+            }
+        }
+        /* rolling statistic */
+        uint64Now = time_us();
+        if ( (MSG_LEVEL_NORM <= msgLevel) && ((uint64Now >= uint64Report) || (interval >= POLL_REPORT_US)) ) {
+            uint64Report = uint64Now + POLL_REPORT_US;
+            poll_stat(uint32PtrSmp, num, uint32PtrTmp, uint32Stat);
+            printf  (   "           seq=%u lat=%u us min/avg/max/p99=%u/%u/%u/%u us err=%u rate=%.1f/s\n",
+                        uint32Num, uint32Lat, uint32Stat[0], uint32Stat[1], uint32Stat[2], uint32Stat[3], uint32Num - uint32Ok,
+                        (double) uint32Num * 1e6 / (double) usbiss_max(uint64Now - uint64Start, (uint64_t) 1)
+                    );
+            fflush(stdout);
+        }
+    }
+    /* summary */
+    uint64Now = time_us();
+    poll_stat(uint32PtrSmp, num, uint32PtrTmp, uint32Stat);
+    if ( MSG_LEVEL_NORM <= msgLevel ) {
+        printf("[ %s ]   Poll statistics device 0x%02x\n", (uint32Ok == uint32Num) ? "OKAY" : "FAIL", xfer->uint8Adr7);
+        printf("             %u transfers, %u ok, %u errors (%u nack), %u late, %.3f s, %.1f transfers/s\n",
+                uint32Num, uint32Ok, uint32Num - uint32Ok, uint32Nack, uint32Late, (double) (uint64Now - uint64Start) / 1e6,
+                (double) uint32Num * 1e6 / (double) usbiss_max(uint64Now - uint64Start, (uint64_t) 1));
+        printf("             latency min/avg/max/p99 = %u/%u/%u/%u us\n", uint32Stat[0], uint32Stat[1], uint32Stat[2], uint32Stat[3]);
+    } else {
+        printf("%u %u %u %u %u %u\n", uint32Num, uint32Num - uint32Ok, uint32Stat[0], uint32Stat[1], uint32Stat[2], uint32Stat[3]);
+    }
+    free(uint32PtrSmp);
+    free(uint32PtrTmp);
+    free(uint8PtrWr);
+    return (uint32Ok == uint32Num) ? 0 : -1;
+}
+
+
+
+/**
+ *  @brief parse EEPROM
+ *
+ *  initializes EEPROM handle from part/geometry and device/range argument
+ *
+ *  @param[in,out]  usbiss          opened USB-ISS
+ *  @param[in]      geo             EEPROM part, f.e. '24C02', or geometry '<adr bytes>:<page size>'
+ *  @param[in]      arg             dump '<adr7>:<ofs>:<len>', program '<adr7>:<ofs>'
+ *  @param[in]      program         0: dump, 1: program
+ *  @param[out]     eeprom          EEPROM handle
+ *  @param[out]     intVal          parsed argument, adr7, ofs, len
+ *  @return         int             0: OK, -1: FAIL
+ *  @since          October 18, 2026
+ */
+static int eeprom_parse (t_usbiss *usbiss, const char *geo, const char *arg, uint8_t program, t_usbiss_eeprom *eeprom, int *intVal)
+{
+    /** Variables **/
+    char        charBuf[64];            // parse buffer
+    char*       charPtrTok;             // token
+    uint8_t     uint8Num = 0;           // number of parsed numbers
+
+    /* EEPROM part or geometry */
+    intVal[0] = intVal[1] = intVal[2] = -1;
+    if ( NULL == strchr(geo, ':') ) {
+        if ( 0 != usbiss_eeprom_init_part(eeprom, usbiss, 0, geo) ) {
+            printf("[ FAIL ]   EEPROM part '%s' unknown, use '--eeprom=<adr bytes>:<page size>'\n", geo);
+            return -1;
+        }
+    } else {
+        strncpy(charBuf, geo, sizeof(charBuf) - 1);
+        charBuf[sizeof(charBuf) - 1] = '\0';
+        charPtrTok = strtok(charBuf, ":");
+        while ( (NULL != charPtrTok) && (uint8Num < 2) ) {
+            intVal[uint8Num++] = to_int(charPtrTok);
+            charPtrTok = strtok(NULL, ":");
+        }
+        if ( (2 != uint8Num) || (0 > intVal[0]) || (255 < intVal[0]) || (0 > intVal[1]) || (65535 < intVal[1]) ) {
+            printf("[ FAIL ]   EEPROM geometry '%s', use '--eeprom=<adr bytes>:<page size>'\n", geo);
+            return -1;
+        }
+        if ( 0 != usbiss_eeprom_init(eeprom, usbiss, 0, (uint8_t) intVal[0], (uint16_t) intVal[1]) ) {
+            printf("[ FAIL ]   EEPROM geometry '%s' unsupported, 1..2 address bytes, max %u byte page\n", geo, USBISS_EEPROM_PAGE_MAX);
+            return -1;
+        }
+    }
+    /* device and range */
+    strncpy(charBuf, arg, sizeof(charBuf) - 1);
+    charBuf[sizeof(charBuf) - 1] = '\0';
+    intVal[0] = intVal[1] = intVal[2] = -1;
+    uint8Num = 0;
+    charPtrTok = strtok(charBuf, ":");
+    while ( (NULL != charPtrTok) && (uint8Num < 3) ) {
+        intVal[uint8Num++] = to_int(charPtrTok);
+        charPtrTok = strtok(NULL, ":");
+    }
+    if ( ((0 == program) && (3 != uint8Num)) || ((0 != program) && (2 != uint8Num)) || (0 > intVal[0]) || (0x7f < intVal[0]) || (0 > intVal[1]) || ((0 == program) && (0 >= intVal[2])) ) {
+        printf("[ FAIL ]   option '%s' unsupported, use %s\n", arg, (0 == program) ? "'--dump=<adr7>:<ofs>:<len> <file>'" : "'--program/--verify=<adr7>:<ofs> <file>'");
+        return -1;
+    }
+    eeprom->uint8Adr7 = (uint8_t) intVal[0];
+    return 0;
+}
+
+
+
+/**
+ *  @brief EEPROM stream
+ *
+ *  state of chunk consumer for dump and verify
+ *
+ *  @since          October 18, 2026
+ */
+struct eeprom_stream {
+    FILE*       filePtrBin;                         /**< binary file */
+    uint8_t     uint8Mode;                          /**< #EEPROM_DUMP or #EEPROM_VERIFY */
+    int         intMsgLevel;                        /**< message level, #MSG_LEVEL */
+    uint32_t    uint32CrcDev;                       /**< CRC32C of EEPROM data */
+    uint32_t    uint32CrcFile;                      /**< CRC32C of file data */
+    uint32_t    uint32MisOfs;                       /**< start of open mismatch range */
+    size_t      sizeMisLen;                         /**< length of open mismatch range, 0: none */
+    size_t      sizeMisBytes;                       /**< number of different bytes */
+    uint32_t    uint32MisRanges;                    /**< number of mismatch ranges */
+    uint8_t     uint8Buf[USBISS_EEPROM_RD_CHUNK];   /**< file chunk */
+};
+
+
+
+/**
+ *  @brief mismatch range end
+ *
+ *  @param[in,out]  st              stream state
+ *  @since          October 18, 2026
+ */
+static void eeprom_mis_close (struct eeprom_stream *st)
+{
+    if ( 0 == st->sizeMisLen ) {
+        return;
+    }
+    ++st->uint32MisRanges;
+    if ( (MSG_LEVEL_NORM <= st->intMsgLevel) && (EEPROM_MIS_PRINT >= st->uint32MisRanges) ) {
+        printf("           mismatch 0x%06x..0x%06x %zu bytes\n", st->uint32MisOfs, st->uint32MisOfs + (uint32_t) st->sizeMisLen - 1, st->sizeMisLen);
+    }
+    st->sizeMisLen = 0;
+}
+
+
+
+/**
+ *  @brief EEPROM sink
+ *
+ *  consumes read chunk, dump: append to file, verify: compare with file
+ *
+ *  @param[in,out]  arg             #eeprom_stream
+ *  @param[in]      ofs             memory offset of chunk
+ *  @param[in]      data            chunk
+ *  @param[in]      len             bytes in chunk
+ *  @return         int             0: OK, -1: file error
+ *  @since          October 18, 2026
+ */
+static int eeprom_sink (void *arg, uint32_t ofs, const uint8_t *data, size_t len)
+{
+    /** Variables **/
+    struct eeprom_stream*   st = arg;   // stream state
+
+    st->uint32CrcDev = usbiss_crc32c(st->uint32CrcDev, data, len);
+    if ( EEPROM_DUMP == st->uint8Mode ) {
+        return (len == fwrite(data, 1, len, st->filePtrBin)) ? 0 : -1;
+    }
+    if ( len != fread(st->uint8Buf, 1, len, st->filePtrBin) ) {
+        return -1;
+    }
+    st->uint32CrcFile = usbiss_crc32c(st->uint32CrcFile, st->uint8Buf, len);
+    if ( 0 == memcmp(data, st->uint8Buf, len) ) {
+        eeprom_mis_close(st);
+        return 0;
+    }
+    for ( size_t i = 0; i < len; i++ ) {
+        if ( data[i] == st->uint8Buf[i] ) {
+            eeprom_mis_close(st);
+            continue;
+        }
+        if ( 0 == st->sizeMisLen ) {
+            st->uint32MisOfs = ofs + (uint32_t) i;
+        }
+        ++st->sizeMisLen;
+        ++st->sizeMisBytes;
+    }
+    return 0;
+}
+
+
+
+/**
+ *  @brief run EEPROM
+ *
+ *  dumps EEPROM range to file, programs file into EEPROM or verifies
+ *  EEPROM against file. The file is streamed in blocks of
+ *  #USBISS_EEPROM_RD_CHUNK bytes, dump and verify process a chunk while
+ *  the next one is read.
+ *
+ *  @param[in,out]  usbiss          opened USB-ISS
+ *  @param[in]      geo             EEPROM part, f.e. '24C02', or geometry '<adr bytes>:<page size>'
+ *  @param[in]      arg             dump '<adr7>:<ofs>:<len>', otherwise '<adr7>:<ofs>'
+ *  @param[in]      path            binary file
+ *  @param[in]      mode            #EEPROM
+ *  @param[in]      msgLevel        message level, #MSG_LEVEL
+ *  @return         int             0: OK, -1: FAIL
+ *  @since          October 18, 2026
+ */
+static int run_eeprom (t_usbiss *usbiss, const char *geo, const char *arg, const char *path, uint8_t mode, int msgLevel)
+{
+    /** Variables **/
+    t_usbiss_eeprom eeprom;             // EEPROM handle
+    struct eeprom_stream*   st;         // dump/verify state
+    int         intVal[3];              // parsed argument, adr7, ofs, len
+    long        lngSize;                // file size
+    size_t      num;                    // bytes in block
+    size_t      done = 0;               // transferred bytes
+    uint64_t    uint64Start;            // transfer start
+    double      dblSec;                 // transfer time
+    int         intRet = 0;             // transfer result
+    const char* charPtrOp[] = {"Dump", "Program", "Program", "Verify"};     // by mode
+
+    /* EEPROM */
+    if ( 0 != eeprom_parse(usbiss, geo, arg, (EEPROM_DUMP == mode) ? 0 : 1, &eeprom, intVal) ) {
+        return -1;
+    }
+    if ( NULL == path ) {
+        printf("[ FAIL ]   binary file missing\n");
+        return -1;
+    }
+    /* open file and block buffer */
+    st = calloc(1, sizeof(struct eeprom_stream));
+    if ( NULL == st ) {
+        printf("[ FAIL ]   memory allocation\n");
+        return -1;
+    }
+    st->filePtrBin = fopen(path, (EEPROM_DUMP == mode) ? "wb" : "rb");
+    if ( NULL == st->filePtrBin ) {
+        printf("[ FAIL ]   open file '%s'\n", path);
+        free(st);
+        return -1;
+    }
+    st->uint8Mode = mode;
+    st->intMsgLevel = msgLevel;
+    /* stream */
+    uint64Start = time_us();
+    if ( EEPROM_DUMP == mode ) {
+        intRet = usbiss_eeprom_rd_stream(&eeprom, (uint32_t) intVal[1], (size_t) intVal[2], eeprom_sink, st);
+        done = (0 == intRet) ? (size_t) intVal[2] : 0;
+    } else if ( EEPROM_VERIFY == mode ) {
+        lngSize = (0 == fseek(st->filePtrBin, 0, SEEK_END)) ? ftell(st->filePtrBin) : -1;
+        if ( (0 > lngSize) || (0 != fseek(st->filePtrBin, 0, SEEK_SET)) ) {
+            printf("[ FAIL ]   file '%s' not seekable\n", path);
+            lngSize = -1;
+        }
+        intRet = (0 > lngSize) ? -1 : usbiss_eeprom_rd_stream(&eeprom, (uint32_t) intVal[1], (size_t) lngSize, eeprom_sink, st);
+        eeprom_mis_close(st);
+        done = (0 == intRet) ? (size_t) lngSize : 0;
+    } else {
+        while ( (0 == intRet) && (0 < (num = fread(st->uint8Buf, 1, USBISS_EEPROM_RD_CHUNK, st->filePtrBin))) ) {
+            if ( EEPROM_PROGRAM == mode ) {
+                intRet = usbiss_eeprom_wr(&eeprom, (uint32_t) intVal[1] + (uint32_t) done, st->uint8Buf, num);
+            } else {
+                intRet = usbiss_eeprom_wr_diff(&eeprom, (uint32_t) intVal[1] + (uint32_t) done, st->uint8Buf, num);
+            }
+            done += (0 == intRet) ? num : 0;
+        }
+        intRet = (0 != ferror(st->filePtrBin)) ? -1 : intRet;
+    }
+    dblSec = (double) usbiss_max(time_us() - uint64Start, (uint64_t) 1) / 1e6;
+    if ( 0 != fclose(st->filePtrBin) ) {
+        intRet = -1;
+    }
+    if ( 0 != st->sizeMisBytes ) {
+        intRet = -1;
+    }
+    /* throughput */
+    if ( MSG_LEVEL_NORM <= msgLevel ) {
+        printf  (   "[ %s ]   %s %zu bytes %s device 0x%02x offset 0x%x %s '%s'\n", (0 == intRet) ? "OKAY" : "FAIL",
+                    charPtrOp[mode], done, (EEPROM_DUMP == mode) ? "from" : ((EEPROM_VERIFY == mode) ? "of" : "to"),
+                    eeprom.uint8Adr7, intVal[1], (EEPROM_DUMP == mode) ? "to" : ((EEPROM_VERIFY == mode) ? "with" : "from"), path
+                );
+        printf("             %.3f s, %.1f byte/s", dblSec, (double) done / dblSec);
+        if ( (EEPROM_PROGRAM == mode) || (EEPROM_DIFF == mode) ) {
+            printf(", %u ACK polls", eeprom.uint32Polls);
+        }
+        if ( EEPROM_DIFF == mode ) {
+            printf(", %u pages changed, %u unchanged", eeprom.uint32PageWr, eeprom.uint32PageSkip);
+        }
+        if ( (EEPROM_DUMP == mode) || (EEPROM_VERIFY == mode) ) {
+            printf(", CRC32C 0x%08x", st->uint32CrcDev);
+        }
+        printf("\n");
+        if ( 0 != st->sizeMisBytes ) {
+            printf("             %zu bytes in %u ranges differ, CRC32C file 0x%08x\n", st->sizeMisBytes, st->uint32MisRanges, st->uint32CrcFile);
+        }
+    } else if ( (EEPROM_DUMP == mode) || (EEPROM_VERIFY == mode) ) {
+        printf("0x%08x\n", st->uint32CrcDev);
+    }
+    free(st);
+    return (0 == intRet) ? 0 : -1;
+}
+
+
+
+/**
+ *  @brief run EEPROM multi
+ *
+ *  programs several EEPROMs with interleaved page writes, the images are
+ *  loaded into memory
+ *
+ *  @param[in,out]  usbiss          opened USB-ISS
+ *  @param[in]      geo             EEPROM part, f.e. '24C02', or geometry '<adr bytes>:<page size>'
+ *  @param[in]      arg             per EEPROM '<adr7>:<ofs>'
+ *  @param[in]      path            per EEPROM binary file
+ *  @param[in]      num             number of EEPROMs
+ *  @param[in]      msgLevel        message level, #MSG_LEVEL
+ *  @return         int             0: OK, -1: FAIL
+ *  @since          October 18, 2026
+ */
+static int run_eeprom_multi (t_usbiss *usbiss, const char *geo, char **arg, char **path, uint8_t num, int msgLevel)
+{
+    /** Variables **/
+    t_usbiss_eeprom     eeprom[EEPROM_MAX_DEV]; // EEPROM handles
+    t_usbiss_eeprom_job job[EEPROM_MAX_DEV];    // programming jobs
+    int         intVal[3];              // parsed argument, adr7, ofs, len
+    FILE*       fh;                     // binary file
+    long        lngSize;                // file size
+    size_t      total = 0;              // all bytes
+    uint64_t    uint64Start;            // transfer start
+    double      dblSec;                 // transfer time
+    int         intRet = -1;            // result
+
+    /* load images */
+    memset(job, 0, sizeof(job));
+    for ( uint8_t i = 0; i < num; i++ ) {
+        if ( 0 != eeprom_parse(usbiss, geo, arg[i], 1, &eeprom[i], intVal) ) {
+            goto EEPROM_MULTI_END;
+        }
+        if ( NULL == path[i] ) {
+            printf("[ FAIL ]   binary file of '%s' missing\n", arg[i]);
+            goto EEPROM_MULTI_END;
+        }
+        job[i].eeprom = &eeprom[i];
+        job[i].ofs = (uint32_t) intVal[1];
+        fh = fopen(path[i], "rb");
+        if ( NULL == fh ) {
+            printf("[ FAIL ]   open file '%s'\n", path[i]);
+            goto EEPROM_MULTI_END;
+        }
+        lngSize = (0 == fseek(fh, 0, SEEK_END)) ? ftell(fh) : -1;
+        if ( (0 > lngSize) || (0 != fseek(fh, 0, SEEK_SET)) ) {
+            printf("[ FAIL ]   file '%s' not seekable\n", path[i]);
+            fclose(fh);
+            goto EEPROM_MULTI_END;
+        }
+        job[i].data = (0 < lngSize) ? malloc((size_t) lngSize) : NULL;
+        if ( (0 < lngSize) && ((NULL == job[i].data) || ((size_t) lngSize != fread((void*) job[i].data, 1, (size_t) lngSize, fh))) ) {
+            printf("[ FAIL ]   read file '%s'\n", path[i]);
+            fclose(fh);
+            goto EEPROM_MULTI_END;
+        }
+        fclose(fh);
+        job[i].len = (0 < lngSize) ? (size_t) lngSize : 0;
+        total += job[i].len;
+    }
+    /* program */
+    uint64Start = time_us();
+    intRet = usbiss_eeprom_wr_multi(job, num);
+    dblSec = (double) usbiss_max(time_us() - uint64Start, (uint64_t) 1) / 1e6;
+    /* per EEPROM completion */
+    if ( MSG_LEVEL_NORM <= msgLevel ) {
+        for ( uint8_t i = 0; i < num; i++ ) {
+            printf  (   "[ %s ]   Program %zu bytes to device 0x%02x offset 0x%x from '%s'\n", (0 == job[i].intRet) ? "OKAY" : "FAIL",
+                        job[i].done, eeprom[i].uint8Adr7, job[i].ofs, path[i]
+                    );
+            printf("             finished after %.3f s, %u ACK polls\n", (double) job[i].uint32Us / 1e6, eeprom[i].uint32Polls);
+        }
+        printf("[ %s ]   Program %u EEPROMs interleaved\n", (0 == intRet) ? "OKAY" : "FAIL", num);
+        printf("             %.3f s, %.1f byte/s\n", dblSec, (double) total / dblSec);
+    }
+    /* release */
+    EEPROM_MULTI_END:
+    for ( uint8_t i = 0; i < num; i++ ) {
+        free((void*) job[i].data);
+    }
+    return (0 == intRet) ? 0 : -1;
+}
+
+
+
 // **************************************************************************
 // Function: to print help command
 // **************************************************************************
@@ -380,7 +1359,38 @@ void usbiss_term_help(const char path[])
         "                                <adr7> w <b0> <bn>    : I2C write access with arbitrary number of write bytes <bn>\n"
         "                                <adr7> r <cnt>        : I2C read access with <cnt> bytes read\n"
         "                                <adr7> w <bn> r <cnt> : I2C write access followed by repeated start with read access\n"
+        "                                <mux>/<ch>/<adr7> ... : I2C access to device behind multiplexer channel, see '-M'\n"
         "  -s, --scan=[0x03:0x77]      Scans I2C bus for I2C devices, optional argument is [start:stop] address\n"
+        "  -M, --mux=<adr7>[:<part>]   Declares multiplexer [PCA9540 | PCA9542 | PCA9543 | PCA9544 | PCA9545 | PCA9546 | PCA9548]\n"
+        "                                default PCA9548, repeatable, '-s' scans all channels\n"
+        "  -q, --qualify=\"<pkg>\"      Runs <pkg> at every I2C mode and selects fastest reliable mode for <adr7>\n"
+        "  -k, --clkfile=<file>        Load I2C clock profiles for adapter, stores result of '-q'\n"
+        "  -r, --retry=[1]             Attempts per I2C transfer, retries with backoff and bus recovery\n"
+        "  -n, --serial=<sn>           Open USB-ISS with USB serial number <sn>, overrules '-p'\n"
+        "  -C, --cache=<file>          Handshake cache, skips ID and serial request for known adapters\n"
+        "  -f, --script=<file|->       Executes commands of file or stdin over one session, one per line:\n"
+        "                                <adr7> w <bn> r <cnt> : I2C access, see '-c'\n"
+        "                                mode <mode>           : change I2C transfer mode\n"
+        "                                delay <us>            : wait\n"
+        "                                scan [start:stop]     : scan I2C bus\n"
+        "  -P, --poll=\"<pkg>\"         Repeats <pkg> at fixed rate and reports latency, stop with Ctrl+C\n"
+        "  -N, --count=[0]             Number of poll transfers, 0: until Ctrl+C\n"
+        "  -i, --interval=[%u]    Poll interval in us\n"
+        "  -L, --log=<file>            Captures '-P' samples into memory mapped ring <file>\n"
+        "  -R, --records=[%u]       Number of records in ring of '-L', bounds file size\n"
+        "  -X, --export=<file>         Writes records of ring <file> as CSV to stdout\n"
+        "  -D, --dump=<adr7>:<ofs>:<len> <file>\n"
+        "                              Reads <len> bytes from EEPROM <adr7> starting at <ofs> into binary <file>\n"
+        "  -W, --program=<adr7>:<ofs> <file>\n"
+        "                              Writes binary <file> into EEPROM <adr7> starting at <ofs>\n"
+        "                              Repeated '-W' program up to %u EEPROMs with interleaved page writes\n"
+        "  -u, --diff                  '-W' reads EEPROM and writes only changed pages with verify\n"
+        "  -V, --verify=<adr7>:<ofs> <file>\n"
+        "                              Compares EEPROM <adr7> starting at <ofs> with binary <file>, reports CRC32C and mismatch ranges\n"
+        "  -e, --eeprom=[%s]         EEPROM part [24C01 .. 24C512 | 24M01 | 24M02] or geometry <adr bytes>:<page size>\n"
+        "  -d, --daemon                Keep USB-ISS open and serve requests on socket\n"
+        "  -S, --socket=<path>         Daemon socket, default: %s\n"
+        "                              Without '-d' the request is passed to the daemon\n"
         "  -h, --help                  Help\n"
         "  -v, --version               Version\n"
         "  -l, --list                  List USBISS suitable UART ports\n"
@@ -403,6 +1413,11 @@ void usbiss_term_help(const char path[])
         "\n",
         path,
         USBISS_UART_BAUD_RATE,
+        POLL_INTERVAL_US,
+        USBISS_LOG_SLOTS,
+        EEPROM_MAX_DEV,
+        EEPROM_GEO,
+        USBISS_IPC_SOCKET,
         uart
     );
 }
@@ -430,8 +1445,40 @@ int main (int argc, char *argv[])
     uint8_t*    uint8PtrWrRd = NULL;            // array with write/read data
     uint32_t    uint32WrLen = 0;                // number of write elements in uint8PtrWrRd
     uint32_t    uint32RdLen = 0;                // number of read elements in uint8PtrWr
-    uint8_t*    uint8PtrHelp = NULL;            // help variable for wr-rd i2c function
     int8_t      int8I2cDevices[128];            // list with addresses of present i2c devices, I2C 7bit addressing -> 128
+    char*       charPtrMux[USBISS_I2C_MUX_MAX]; // CLI: multiplexer <adr7>[:<part>]
+    uint8_t     uint8MuxNum = 0;                // CLI: number of multiplexers
+    uint8_t     uint8MuxAdr = USBISS_I2C_MUX_ROOT;  // multiplexer of command route
+    uint8_t     uint8MuxCh = 0;                 // multiplexer channel of command route
+    t_usbiss_i2c_route  i2cRoute[128];          // devices of multiplexer scan
+    int         intRoute = 0;                   // number of elements in i2cRoute
+    char*       charPtrQual = NULL;             // CLI: I2C clock qualification pattern
+    char*       charPtrClkFile = NULL;          // CLI: I2C clock profile file
+    t_usbiss_i2c_qual   i2cQual;                // I2C clock qualification
+    t_usbiss_retry      i2cRetry;               // I2C retry policy
+    uint8_t     uint8Attempts = 1;              // CLI: attempts per I2C transfer
+    char*       charPtrSerial = NULL;           // CLI: USB serial number of adapter
+    char*       charPtrCache = NULL;            // CLI: handshake cache file
+    char*       charPtrSocket = NULL;           // CLI: daemon socket
+    char*       charPtrScript = NULL;           // CLI: script file
+    char*       charPtrPoll = NULL;             // CLI: poll transfer
+    uint32_t    uint32PollCnt = 0;              // CLI: number of poll transfers
+    uint32_t    uint32PollInterval = POLL_INTERVAL_US;  // CLI: poll interval
+    char*       charPtrLog = NULL;              // CLI: capture ring file
+    uint32_t    uint32LogSlots = USBISS_LOG_SLOTS;  // CLI: records in capture ring
+    char*       charPtrExport = NULL;           // CLI: ring file for CSV export
+    t_usbiss_log    log;                        // capture ring
+    t_usbiss_i2c_xfer   i2cXfer;                // poll transfer
+    char*       charPtrEeprom[EEPROM_MAX_DEV];  // CLI: EEPROM dump/program range
+    uint8_t     uint8EepromNum = 0;             // CLI: number of EEPROM ranges
+    char*       charPtrEepromFile[EEPROM_MAX_DEV];  // CLI: EEPROM binary files
+    char*       charPtrEepromGeo = EEPROM_GEO;  // CLI: EEPROM geometry
+    uint8_t     uint8EepromPrg = EEPROM_DUMP;   // CLI: EEPROM operation, #EEPROM
+    uint8_t     uint8EepromDiff = 0;            // CLI: program only changed pages
+    uint8_t     uint8Daemon = 0;                // CLI: serve requests on socket
+    uint8_t     uint8ModeSet = 0;               // CLI: mode explicitly requested
+    int         intIpc = -1;                    // daemon connection
+    t_usbiss_ipc_info   ipcInfo;                // adapter served by daemon
     int         intRet;                         // help variable for function return
 
 
@@ -449,6 +1496,26 @@ int main (int argc, char *argv[])
         {"mode",        required_argument,  0,  'm'},
         {"command",     required_argument,  0,  'c'},
         {"scan",        optional_argument,  0,  's'},   // requires in shortop '::'
+        {"mux",         required_argument,  0,  'M'},
+        {"qualify",     required_argument,  0,  'q'},
+        {"clkfile",     required_argument,  0,  'k'},
+        {"retry",       required_argument,  0,  'r'},
+        {"serial",      required_argument,  0,  'n'},
+        {"cache",       required_argument,  0,  'C'},
+        {"script",      required_argument,  0,  'f'},
+        {"poll",        required_argument,  0,  'P'},
+        {"count",       required_argument,  0,  'N'},
+        {"interval",    required_argument,  0,  'i'},
+        {"log",         required_argument,  0,  'L'},
+        {"records",     required_argument,  0,  'R'},
+        {"export",      required_argument,  0,  'X'},
+        {"dump",        required_argument,  0,  'D'},
+        {"program",     required_argument,  0,  'W'},
+        {"verify",      required_argument,  0,  'V'},
+        {"eeprom",      required_argument,  0,  'e'},
+        {"diff",        no_argument,        0,  'u'},
+        {"daemon",      no_argument,        0,  'd'},
+        {"socket",      required_argument,  0,  'S'},
         {"version",     no_argument,        0,  'v'},
         {"list",        no_argument,        0,  'l'},
         {"test",        no_argument,        0,  't'},
@@ -456,17 +1523,9 @@ int main (int argc, char *argv[])
         /* Protection */
         {0,             0,                  0,  0 }     // NULL
     };
-    static const char shortopt[] = "p:b:m:c:s::vlth";
-
+    static const char shortopt[] = "p:b:m:c:s::M:q:k:r:n:C:f:P:N:i:L:R:X:D:W:V:e:udS:vlth";
 
 
-    /* check for root rights */
-    #if defined(__linux__) || defined(__APPLE__)
-        if (getuid()) {
-            if ( MSG_LEVEL_NORM <= intMsgLevel ) { printf("[ FAIL ]   Root rights required! Try 'sudo %s'\n", argv[0]); }
-            goto ERO_END_L0;
-        }
-    #endif
 
     /* no param, no operation */
     if (argc < 2) {
@@ -521,6 +1580,7 @@ int main (int argc, char *argv[])
                 }
                 /* copy user path */
                 strncpy(charMode, optarg, sizeof(charMode));
+                uint8ModeSet = 1;
                 break;
 
             /* process '--command=<cmd>' argument */
@@ -574,6 +1634,113 @@ int main (int argc, char *argv[])
                 }
                 break;
 
+            /* process '--qualify=<cmd>' argument */
+            case 'q':
+                charPtrQual = optarg;
+                break;
+
+            /* process '--clkfile=<file>' argument */
+            case 'k':
+                charPtrClkFile = optarg;
+                break;
+
+            /* process '--retry=<attempts>' argument */
+            case 'r':
+                uint8Attempts = (uint8_t) usbiss_max(usbiss_min(to_int(optarg), 255), 1);
+                break;
+
+            /* process '--serial=<sn>' argument */
+            case 'n':
+                charPtrSerial = optarg;
+                break;
+
+            /* process '--cache=<file>' argument */
+            case 'C':
+                charPtrCache = optarg;
+                break;
+
+            /* process '--script=<file>' argument */
+            case 'f':
+                charPtrScript = optarg;
+                break;
+
+            /* process '--poll=<cmd>' argument */
+            case 'P':
+                charPtrPoll = optarg;
+                break;
+
+            /* process '--count=<n>' argument */
+            case 'N':
+                uint32PollCnt = (uint32_t) usbiss_max(to_int(optarg), 0);
+                break;
+
+            /* process '--interval=<us>' argument */
+            case 'i':
+                uint32PollInterval = (uint32_t) usbiss_max(to_int(optarg), 0);
+                break;
+
+            /* process '--mux=<adr7>[:<part>]' argument, repeatable */
+            case 'M':
+                if ( USBISS_I2C_MUX_MAX <= uint8MuxNum ) {
+                    if ( MSG_LEVEL_NORM <= intMsgLevel ) {
+                        printf("[ FAIL ]   up to %u '-M' per call\n", USBISS_I2C_MUX_MAX);
+                    }
+                    goto ERO_END_L0;
+                }
+                charPtrMux[uint8MuxNum++] = optarg;
+                break;
+
+            /* process '--log=<file>' argument */
+            case 'L':
+                charPtrLog = optarg;
+                break;
+
+            /* process '--records=<n>' argument */
+            case 'R':
+                uint32LogSlots = (uint32_t) usbiss_max(to_int(optarg), 1);
+                break;
+
+            /* process '--export=<file>' argument */
+            case 'X':
+                charPtrExport = optarg;
+                break;
+
+            /* process '--dump=<adr7>:<ofs>:<len>' argument */
+            /* process '--program=<adr7>:<ofs>' argument, repeatable for interleaved programming */
+            /* process '--verify=<adr7>:<ofs>' argument */
+            case 'D':
+            case 'W':
+            case 'V':
+                if ( (EEPROM_MAX_DEV <= uint8EepromNum) || ((0 != uint8EepromNum) && ((EEPROM_PROGRAM != uint8EepromPrg) || ('W' != opt))) ) {
+                    if ( MSG_LEVEL_NORM <= intMsgLevel ) {
+                        printf("[ FAIL ]   up to %u '-W' or one '-D'/'-V' per call\n", EEPROM_MAX_DEV);
+                    }
+                    goto ERO_END_L0;
+                }
+                charPtrEeprom[uint8EepromNum++] = optarg;
+                uint8EepromPrg = ('W' == opt) ? EEPROM_PROGRAM : (('V' == opt) ? EEPROM_VERIFY : EEPROM_DUMP);
+                break;
+
+            /* process '--eeprom=<adr bytes>:<page size>' argument */
+            case 'e':
+                charPtrEepromGeo = optarg;
+                break;
+
+            /* process '--diff' argument */
+            case 'u':
+                uint8EepromDiff = 1;
+                break;
+
+            /* process '--daemon' argument */
+            case 'd':
+                uint8Daemon = 1;
+                break;
+
+            /* process '--socket=<path>' argument */
+            case 'S':
+                charPtrSocket = optarg;
+                break;
+
             /* Print command line options */
             case 'h':
                 usbiss_term_help(argv[0]);
@@ -611,6 +1778,24 @@ int main (int argc, char *argv[])
         }
     }
 
+    /* CSV export of capture ring, no adapter needed */
+    if ( NULL != charPtrExport ) {
+        intMsgLevel = MSG_LEVEL_BRIEF;  // CSV only
+        if ( 0 > usbiss_log_csv(charPtrExport, stdout) ) {
+            fprintf(stderr, "[ FAIL ]   capture ring '%s'\n", charPtrExport);
+            goto ERO_END_L0;
+        }
+        goto GD_END_L0;
+    }
+
+    /* check for root rights, daemon clients access the USB-ISS by socket */
+    #if defined(__linux__) || defined(__APPLE__)
+        if ( ((NULL == charPtrSocket) || (0 != uint8Daemon)) && getuid() ) {
+            if ( MSG_LEVEL_NORM <= intMsgLevel ) { printf("[ FAIL ]   Root rights required! Try 'sudo %s'\n", argv[0]); }
+            goto ERO_END_L0;
+        }
+    #endif
+
     /* Entry Message */
     if ( MSG_LEVEL_NORM <= intMsgLevel ) {
         printf("[ INFO ]   USBISS started\n");
@@ -627,16 +1812,92 @@ int main (int argc, char *argv[])
         usbiss_set_verbose(&usbiss, 1); // enable advanced output
     }
 
+    /* handshake cache */
+    if ( NULL != charPtrCache ) {
+        if ( 0 != usbiss_set_cache(&usbiss, charPtrCache) ) {
+            printf("[ FAIL ]   handshake cache '%s'\n", charPtrCache);
+            goto ERO_END_L0;
+        }
+    }
+
+    /* retry policy, recover bus before retry */
+    if ( 1 < uint8Attempts ) {
+        i2cRetry = usbiss.retry;
+        i2cRetry.uint8Attempts = uint8Attempts;
+        i2cRetry.uint8Recover = 1;
+        usbiss_set_retry(&usbiss, &i2cRetry);
+    }
+
     /* check for proper command */
-    if ( (0 == uint8TestUsbIss) && (-1 == int8I2cScanAdr[0]) ) {   // check only if no connection test
+    if ( (0 == uint8TestUsbIss) && (-1 == int8I2cScanAdr[0]) && (0 == uint8Daemon) && (NULL == charPtrScript) && (0 == uint8EepromNum) ) {   // check only if no connection test
+        if ( (NULL != charPtrQual) || (NULL != charPtrPoll) ) {
+            free(charPtrCmd);   // '-c' is overruled
+            charPtrCmd = NULL;
+        }
+        if ( NULL != charPtrQual ) {
+            charPtrCmd = charPtrQual;   // pattern for qualification
+        }
+        if ( NULL != charPtrPoll ) {
+            charPtrCmd = charPtrPoll;   // repeated transfer
+        }
         if ( NULL == charPtrCmd ) {
             printf("[ FAIL ]   no transfer requested, use -c for proper args\n");
             goto ERO_END_L0;
         }
+        if ( (0 != process_route(charPtrCmd, &uint8MuxAdr, &uint8MuxCh)) || ((USBISS_I2C_MUX_ROOT != uint8MuxAdr) && ((NULL != charPtrQual) || (NULL != charPtrPoll))) ) {
+            printf("[ FAIL ]   route '<mux>/<ch>/<adr7>' incomplete or not with '-q' and '-P'\n");
+            goto ERO_END_L0;
+        }
         if ( 0 != process_cmd(charPtrCmd, &uint8I2cAdr, &uint8PtrWrRd, &uint32WrLen, &uint32RdLen) ) {
             printf("[ FAIL ]   option '-c %s' unsupported, use --help for proper read/write command\n", charPtrCmd);
             goto ERO_END_L0;
         }
+        if ( (NULL != charPtrQual) || (NULL != charPtrPoll) ) {
+            charPtrCmd = NULL;  // not allocated by '-c'
+        }
+    }
+
+    /* thin client, USB-ISS is kept open by daemon */
+    if ( (NULL != charPtrSocket) && (0 == uint8Daemon) ) {
+        if ( (NULL != charPtrQual) || (NULL != charPtrScript) || (NULL != charPtrPoll) || (0 != uint8EepromNum) || (0 != uint8MuxNum) || (USBISS_I2C_MUX_ROOT != uint8MuxAdr) ) {
+            printf("[ FAIL ]   options '-q', '-f', '-P', '-D', '-W' and '-M' not supported by daemon\n");
+            goto ERO_END_L1;
+        }
+        intIpc = usbiss_ipc_connect(charPtrSocket);
+        if ( (0 > intIpc) || (0 != usbiss_ipc_info(intIpc, &ipcInfo)) ) {
+            if ( MSG_LEVEL_NORM <= intMsgLevel ) {
+                printf("[ FAIL ]   no USBISS daemon at '%s'\n", charPtrSocket);
+            }
+            goto ERO_END_L1;
+        }
+        if ( 0 != uint8ModeSet ) {
+            if ( (0 != usbiss_ipc_set_mode(intIpc, charMode)) || (0 != usbiss_ipc_info(intIpc, &ipcInfo)) ) {
+                printf("[ FAIL ]   USBISS mode setup\n");
+                goto ERO_END_L1;
+            }
+        }
+        if ( MSG_LEVEL_NORM <= intMsgLevel ) {
+            printf("[ OKAY ]   USBISS daemon connected\n");
+            printf("             Socket   : %s\n", charPtrSocket);
+            printf("             Port     : %s\n", ipcInfo.charPort);
+            printf("             Firmware : 0x%02x\n", ipcInfo.uint8Fw);
+            printf("             Serial   : %s\n", ipcInfo.charSerial);
+            printf("             Mode     : %s\n", usbiss_mode_to_human(ipcInfo.uint8Mode));
+        }
+        if ( 0 != uint8TestUsbIss ) {
+            goto GD_END_L1;
+        }
+        goto I2C_ACCESS_L1;
+    }
+
+    /* adapter by serial number */
+    if ( NULL != charPtrSerial ) {
+        if ( 0 != usbiss_find_uart(charPtrSerial, charPort, sizeof(charPort)) ) {
+            if ( MSG_LEVEL_NORM <= intMsgLevel ) {
+                printf("[ FAIL ]   no USB-ISS with serial '%s' found\n", charPtrSerial);
+            }
+            goto ERO_END_L0;
+        }
     }
 
     /* open UART Port */
@@ -672,15 +1933,157 @@ int main (int argc, char *argv[])
         printf("             Mode     : %s\n", usbiss_mode_to_human(usbiss.uint8Mode));
     }
 
+    /* I2C clock profiles */
+    if ( NULL != charPtrClkFile ) {
+        intRet = usbiss_i2c_clk_load(&usbiss, charPtrClkFile);
+        if ( (0 < intRet) && (MSG_LEVEL_NORM <= intMsgLevel) ) {
+            printf("             Profiles : %i from %s\n", intRet, charPtrClkFile);
+        }
+    }
+
+    /* I2C multiplexers */
+    for ( uint8_t i = 0; i < uint8MuxNum; i++ ) {
+        charPtrHelp = strchr(charPtrMux[i], ':');
+        if ( 0 != usbiss_i2c_mux_add(&usbiss, (uint8_t) to_int(charPtrMux[i]), (NULL != charPtrHelp) ? charPtrHelp+1 : NULL) ) {
+            printf("[ FAIL ]   option '-M %s' unsupported\n", charPtrMux[i]);
+            goto ERO_END_L1;
+        }
+    }
+
+    /* script over one session */
+    if ( NULL != charPtrScript ) {
+        if ( 0 != run_script(&usbiss, charPtrScript, intMsgLevel) ) {
+            goto ERO_END_L1;
+        }
+        goto GD_END_L1;
+    }
+
+    /* repeat transfer */
+    if ( NULL != charPtrPoll ) {
+        i2cXfer.uint8Adr7 = uint8I2cAdr;
+        i2cXfer.wr = uint8PtrWrRd;
+        i2cXfer.wrLen = (size_t) uint32WrLen;
+        i2cXfer.rdLen = (size_t) uint32RdLen;
+        i2cXfer.rd = malloc(usbiss_max(uint32RdLen, (uint32_t) 1));
+        if ( NULL != charPtrLog ) {
+            if ( 0 != usbiss_log_create(&log, charPtrLog, uint32LogSlots) ) {
+                printf("[ FAIL ]   capture ring '%s'\n", charPtrLog);
+                free(i2cXfer.rd);
+                free(uint8PtrWrRd);
+                goto ERO_END_L1;
+            }
+        }
+        intRet = (NULL != i2cXfer.rd) ? run_poll(&usbiss, &i2cXfer, uint32PollCnt, uint32PollInterval, (NULL != charPtrLog) ? &log : NULL, intMsgLevel) : -1;
+        if ( NULL != charPtrLog ) {
+            usbiss_log_close(&log);
+        }
+        free(i2cXfer.rd);
+        free(uint8PtrWrRd);
+        if ( 0 != intRet ) {
+            goto ERO_END_L1;
+        }
+        goto GD_END_L1;
+    }
+
+    /* EEPROM dump/program/verify, binary files are the non-option arguments in order of '-D'/'-W'/'-V' */
+    if ( 1 == uint8EepromNum ) {
+        if ( 0 != run_eeprom(&usbiss, charPtrEepromGeo, charPtrEeprom[0], (optind < argc) ? argv[optind] : NULL, ((EEPROM_PROGRAM == uint8EepromPrg) && (0 != uint8EepromDiff)) ? EEPROM_DIFF : uint8EepromPrg, intMsgLevel) ) {
+            goto ERO_END_L1;
+        }
+        goto GD_END_L1;
+    }
+    if ( 1 < uint8EepromNum ) {
+        if ( 0 != uint8EepromDiff ) {
+            printf("[ FAIL ]   option '--diff' only for one '-W'\n");
+            goto ERO_END_L1;
+        }
+        for ( uint8_t i = 0; i < uint8EepromNum; i++ ) {
+            charPtrEepromFile[i] = (optind + i < argc) ? argv[optind + i] : NULL;
+        }
+        if ( 0 != run_eeprom_multi(&usbiss, charPtrEepromGeo, charPtrEeprom, charPtrEepromFile, uint8EepromNum, intMsgLevel) ) {
+            goto ERO_END_L1;
+        }
+        goto GD_END_L1;
+    }
+
+    /* serve requests until SIGINT/SIGTERM */
+    if ( 0 != uint8Daemon ) {
+        usbiss_hotplug_enable(&usbiss, 1);  // survive USB re-enumeration
+        signal(SIGINT, usbiss_term_stop);
+        signal(SIGTERM, usbiss_term_stop);
+        if ( MSG_LEVEL_NORM <= intMsgLevel ) {
+            printf("[ OKAY ]   USBISS daemon serving\n");
+            printf("             Socket   : %s\n", (NULL != charPtrSocket) ? charPtrSocket : USBISS_IPC_SOCKET);
+        }
+        fflush(stdout);
+        if ( 0 != usbiss_ipc_serve(&usbiss, charPtrSocket, &g_sigStop) ) {
+            printf("[ FAIL ]   USBISS daemon\n");
+            goto ERO_END_L1;
+        }
+        goto GD_END_L1;
+    }
+
+    /* I2C clock qualification */
+    if ( NULL != charPtrQual ) {
+        memset(&i2cQual, 0, sizeof(i2cQual));
+        i2cQual.uint8Adr7 = uint8I2cAdr;
+        i2cQual.wr = uint8PtrWrRd;
+        i2cQual.wrLen = (size_t) uint32WrLen;
+        i2cQual.rdLen = (size_t) uint32RdLen;
+        i2cQual.uint8Cmp = 1;   // pattern is expected to read static data
+        intRet = usbiss_i2c_qualify(&usbiss, &i2cQual);
+        if ( MSG_LEVEL_NORM <= intMsgLevel ) {
+            printf("[ %s ]   I2C clock qualification of device 0x%02x\n", (0 < intRet) ? "OKAY" : "FAIL", uint8I2cAdr);
+            printf("             %-14s %8s %8s %8s %10s %10s\n", "Mode", "Xfer", "NACK", "Error", "Time/us", "Byte/s");
+            for ( uint8_t i = 0; i < USBISS_I2C_NUM_CLK; i++ ) {
+                printf  (   "             %-14s %8u %8u %8u %10u %10u\n",
+                            usbiss_mode_to_human(i2cQual.mode[i].uint8Mode), i2cQual.mode[i].uint32Xfer,
+                            i2cQual.mode[i].uint32Nack, i2cQual.mode[i].uint32Ero, i2cQual.mode[i].uint32Us,
+                            i2cQual.mode[i].uint32Bps
+                        );
+            }
+        }
+        free(uint8PtrWrRd);
+        if ( 0 > intRet ) {
+            goto ERO_END_L1;
+        }
+        printf("%s%s\n", (MSG_LEVEL_NORM <= intMsgLevel) ? "             Selected : " : "", usbiss_mode_to_human((uint8_t) intRet));
+        /* persist choice */
+        if ( NULL != charPtrClkFile ) {
+            if ( 0 != usbiss_i2c_clk_save(&usbiss, charPtrClkFile) ) {
+                printf("[ FAIL ]   store I2C clock profile in %s\n", charPtrClkFile);
+                goto ERO_END_L1;
+            }
+        }
+        goto GD_END_L1;
+    }
+
     /* I2C Scan? */
+    goto I2C_ACCESS_L1; // avoid compile warning
+    I2C_ACCESS_L1:
     if ( -1 != int8I2cScanAdr[0] ) {
         /* USB-ISS configured for I2C mode */
-        if ( 0 != usbiss_is_i2c_mode(usbiss.uint8Mode) ) {
+        if ( 0 != usbiss_is_i2c_mode((0 > intIpc) ? usbiss.uint8Mode : ipcInfo.uint8Mode) ) {
             printf("[ FAIL ]   Option '-s' only for I2C mode available\n");
             goto ERO_END_L1;
         }
         /* scan i2c address */
-        intRet = usbiss_i2c_scan(&usbiss, int8I2cScanAdr[0], int8I2cScanAdr[1], (int8_t*) &int8I2cDevices, sizeof(int8I2cDevices)/sizeof(int8I2cDevices[0]));
+        if ( (0 > intIpc) && (0 != usbiss.uint8MuxNum) ) {
+            intRoute = usbiss_i2c_mux_scan(&usbiss, int8I2cScanAdr[0], int8I2cScanAdr[1], i2cRoute, sizeof(i2cRoute)/sizeof(i2cRoute[0]));
+            intRet = intRoute;
+            if ( 0 <= intRoute ) {  // root bus in table, channels as route
+                intRet = 0;
+                for ( int i = 0; i < intRoute; i++ ) {
+                    if ( USBISS_I2C_MUX_ROOT == i2cRoute[i].uint8Mux ) {
+                        int8I2cDevices[intRet++] = (int8_t) i2cRoute[i].uint8Adr7;
+                    }
+                }
+            }
+        } else if ( 0 > intIpc ) {
+            intRet = usbiss_i2c_scan(&usbiss, int8I2cScanAdr[0], int8I2cScanAdr[1], (int8_t*) &int8I2cDevices, sizeof(int8I2cDevices)/sizeof(int8I2cDevices[0]));
+        } else {
+            intRet = usbiss_ipc_i2c_scan(intIpc, int8I2cScanAdr[0], int8I2cScanAdr[1], (int8_t*) &int8I2cDevices, sizeof(int8I2cDevices)/sizeof(int8I2cDevices[0]));
+        }
         if ( 0 > intRet ) {
             if ( MSG_LEVEL_NORM <= intMsgLevel ) {
                 printf("[ FAIL ]   Scan I2C bus in range 0x%0x:0x%0x\n", int8I2cScanAdr[0], int8I2cScanAdr[1]);
@@ -709,16 +2112,33 @@ int main (int argc, char *argv[])
                           (uint8_t) (intRet & 0xff) // found i2c devices
                        );
         printf("%s", charPtrBuf);
+        for ( int i = 0; i < intRoute; i++ ) {
+            if ( USBISS_I2C_MUX_ROOT != i2cRoute[i].uint8Mux ) {
+                printf("%s0x%02x/%u/0x%02x\n", charHelp, i2cRoute[i].uint8Mux, i2cRoute[i].uint8Channel, i2cRoute[i].uint8Adr7);
+            }
+        }
         /* release memory */
         free(charPtrBuf);
         /* normale end */
         goto GD_END_L1;
     }
 
-    /* perform access */
+    /* perform access, read data behind write data */
+    i2cXfer.uint8Adr7 = uint8I2cAdr;
+    i2cXfer.wr = uint8PtrWrRd;
+    i2cXfer.wrLen = (size_t) uint32WrLen;
+    i2cXfer.rd = uint8PtrWrRd + uint32WrLen;
+    i2cXfer.rdLen = (size_t) uint32RdLen;
     if ( (0 != uint32WrLen) && (0 == uint32RdLen) ) {
         /* write access only */
-        if ( 0 == usbiss_i2c_wr(&usbiss, uint8I2cAdr, (void*) uint8PtrWrRd, (size_t) uint32WrLen) ) {
+        if ( USBISS_I2C_MUX_ROOT != uint8MuxAdr ) {
+            intRet = usbiss_i2c_mux_xfer(&usbiss, uint8MuxAdr, uint8MuxCh, &i2cXfer);
+        } else if ( 0 > intIpc ) {
+            intRet = usbiss_i2c_wr(&usbiss, uint8I2cAdr, (void*) uint8PtrWrRd, (size_t) uint32WrLen);
+        } else {
+            intRet = usbiss_ipc_i2c(intIpc, uint8I2cAdr, uint8PtrWrRd, (size_t) uint32WrLen, NULL, 0);
+        }
+        if ( 0 == intRet ) {
             if ( MSG_LEVEL_NORM <= intMsgLevel ) {
                 printf("[ OKAY ]   Write %i bytes to device 0x%02x\n", uint32WrLen, uint8I2cAdr);
                 print_hexdump("             ", uint8PtrWrRd, uint32WrLen);
@@ -731,7 +2151,14 @@ int main (int argc, char *argv[])
         }
     } else if ( (0 == uint32WrLen) && (0 != uint32RdLen) ) {
         /* read access only */
-        if ( 0 == usbiss_i2c_rd(&usbiss, uint8I2cAdr, (void*) uint8PtrWrRd, (size_t) uint32RdLen) ) {
+        if ( USBISS_I2C_MUX_ROOT != uint8MuxAdr ) {
+            intRet = usbiss_i2c_mux_xfer(&usbiss, uint8MuxAdr, uint8MuxCh, &i2cXfer);
+        } else if ( 0 > intIpc ) {
+            intRet = usbiss_i2c_rd(&usbiss, uint8I2cAdr, (void*) uint8PtrWrRd, (size_t) uint32RdLen);
+        } else {
+            intRet = usbiss_ipc_i2c(intIpc, uint8I2cAdr, NULL, 0, uint8PtrWrRd, (size_t) uint32RdLen);
+        }
+        if ( 0 == intRet ) {
             if ( MSG_LEVEL_NORM <= intMsgLevel ) {
                 printf("[ OKAY ]   Read %i bytes from device 0x%02x\n", uint32RdLen, uint8I2cAdr);
                 print_hexdump("             ", uint8PtrWrRd, uint32RdLen);
@@ -751,26 +2178,24 @@ int main (int argc, char *argv[])
         }
     } else if ( (0 != uint32WrLen) && (0 != uint32RdLen) ) {
         /* write-read access only */
-            // save write data
-        uint8PtrHelp = malloc(uint32WrLen);
-        if ( NULL != uint8PtrHelp ) {
-            memcpy(uint8PtrHelp, uint8PtrWrRd, uint32WrLen);
+        if ( USBISS_I2C_MUX_ROOT != uint8MuxAdr ) {
+            intRet = usbiss_i2c_mux_xfer(&usbiss, uint8MuxAdr, uint8MuxCh, &i2cXfer);
+        } else if ( 0 > intIpc ) {
+            intRet = usbiss_i2c_xfer(&usbiss, &i2cXfer);
+        } else {
+            intRet = usbiss_ipc_i2c(intIpc, uint8I2cAdr, i2cXfer.wr, i2cXfer.wrLen, i2cXfer.rd, i2cXfer.rdLen);
         }
-            // perform access
-        if ( 0 == usbiss_i2c_wr_rd(&usbiss, uint8I2cAdr, (void*) uint8PtrWrRd, (size_t) uint32WrLen, (size_t) uint32RdLen) ) {
+        if ( 0 == intRet ) {
             if ( MSG_LEVEL_NORM <= intMsgLevel ) {
                 printf("[ OKAY ]   Write/Read interaction with device 0x%02x\n", uint8I2cAdr);
                 printf("           Write %i Bytes\n", uint32WrLen);
-                if ( NULL != uint8PtrHelp ) {
-                    print_hexdump("             ", uint8PtrHelp, uint32WrLen);
-                    free(uint8PtrHelp);
-                }
+                print_hexdump("             ", i2cXfer.wr, uint32WrLen);
                 printf("           Read %i Bytes\n", uint32RdLen);
-                print_hexdump("             ", uint8PtrWrRd, uint32RdLen);
+                print_hexdump("             ", i2cXfer.rd, uint32RdLen);
             } else {
                 charPtrBuf = malloc(3*uint32RdLen+1);
                 if ( NULL != charPtrBuf ) {
-                    sprint_hex(charPtrBuf, uint8PtrWrRd, uint32RdLen);
+                    sprint_hex(charPtrBuf, i2cXfer.rd, uint32RdLen);
                     printf("%s\n", charPtrBuf);
                     free(charPtrBuf);
                 }
@@ -790,6 +2215,7 @@ int main (int argc, char *argv[])
     /* Good End, close connection */
     goto GD_END_L1; // avoid compile warning
     GD_END_L1:
+    usbiss_ipc_close(intIpc);
     if ( 0 != usbiss_close(&usbiss) ) {
         printf("[ FAIL ]   close USBISS connection\n");
         goto ERO_END_L0;
@@ -806,6 +2232,7 @@ int main (int argc, char *argv[])
     /* Error L1 End */
     goto ERO_END_L1;
     ERO_END_L1:
+        usbiss_ipc_close(intIpc);
         usbiss_close(&usbiss);  // ero end, try to close connection
     /* Error L0 End */
     goto ERO_END_L0;
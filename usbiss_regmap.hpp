@@ -0,0 +1,455 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_regmap.hpp
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS register map accessors
+                  header-only C++17 layer of register maps generated
+                  by usbiss_regmap.py:
+                    * frames built at compile time
+                    * adjacent registers read in one burst
+***********************************************************************/
+
+
+
+// Define Guard
+#ifndef __USB_ISS_REGMAP_HPP
+#define __USB_ISS_REGMAP_HPP
+
+
+/** Includes **/
+#include <array>        // std::array
+#include <cstddef>      // size_t
+#include <cstdint>      // fixed data types
+#include <tuple>        // std::tuple
+#include <type_traits>  // std::conditional_t
+#include <utility>      // std::index_sequence
+#include "usbiss.h"     // USBISS driver
+
+
+
+namespace usbiss {
+namespace regmap {
+
+
+
+/**
+ *  @brief  register access
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+enum class Access : uint8_t {
+    RO,     /**< read only */
+    WO,     /**< write only */
+    RW      /**< read write */
+};
+
+
+
+/**
+ *  @brief  register value type
+ *
+ *  smallest unsigned integer holding given number of bytes
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+template <uint8_t Bytes>
+using uint_t = std::conditional_t<(Bytes <= 1), uint8_t,
+               std::conditional_t<(Bytes <= 2), uint16_t,
+               std::conditional_t<(Bytes <= 4), uint32_t, uint64_t>>>;
+
+
+
+/**
+ *  @brief  register
+ *
+ *  register of I2C slave, register address and write frame prefix are
+ *  compile time constants
+ *
+ *  @tparam Adr7        Seven Bit I2C address
+ *  @tparam AdrBytes    number of register address bytes, sent big endian
+ *  @tparam Addr        register address
+ *  @tparam Bytes       register width in bytes
+ *  @tparam Acc         register access
+ *  @tparam BigEndian   byte order of register value
+ *  @tparam Stride      data bytes per register address, 0: pointer register without auto-increment
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+template <uint8_t Adr7, uint8_t AdrBytes, uint32_t Addr, uint8_t Bytes, Access Acc, bool BigEndian = true, uint8_t Stride = 1>
+struct Reg {
+    static_assert(Adr7 < USBISS_I2C_NUM_ADR, "I2C address exceeds 7 bit");
+    static_assert((1 <= AdrBytes) && (AdrBytes <= 4), "register address 1 to 4 bytes");
+    static_assert((1 <= Bytes) && (Bytes <= 8), "register width 1 to 8 bytes");
+
+    using value_type = uint_t<Bytes>;                       /**< register value */
+    static constexpr uint8_t    adr7 = Adr7;                /**< Seven Bit I2C address */
+    static constexpr uint8_t    adrBytes = AdrBytes;        /**< number of register address bytes */
+    static constexpr uint32_t   addr = Addr;                /**< register address */
+    static constexpr uint8_t    bytes = Bytes;              /**< register width */
+    static constexpr Access     access = Acc;               /**< register access */
+    static constexpr bool       bigEndian = BigEndian;      /**< byte order of value */
+    static constexpr uint8_t    stride = Stride;            /**< data bytes per register address, 0: no auto-increment */
+    static constexpr uint32_t   span = (0 == Stride) ? 1 : (Bytes + Stride - 1) / Stride;  /**< covered register addresses */
+
+    /** register address frame */
+    static constexpr std::array<uint8_t, AdrBytes> frame()
+    {
+        std::array<uint8_t, AdrBytes> adr{};
+        for ( size_t i = 0; i < AdrBytes; i++ ) {
+            adr[i] = static_cast<uint8_t>(Addr >> (8 * (AdrBytes - 1 - i)));
+        }
+        return adr;
+    }
+
+    /** value from read data */
+    static constexpr value_type unpack( const uint8_t* data )
+    {
+        value_type val = 0;
+        for ( size_t i = 0; i < Bytes; i++ ) {
+            val = static_cast<value_type>(val | (static_cast<value_type>(data[i]) << (8 * (BigEndian ? (Bytes - 1 - i) : i))));
+        }
+        return val;
+    }
+
+    /** value into write data */
+    static constexpr void pack( value_type val, uint8_t* data )
+    {
+        for ( size_t i = 0; i < Bytes; i++ ) {
+            data[i] = static_cast<uint8_t>(val >> (8 * (BigEndian ? (Bytes - 1 - i) : i)));
+        }
+    }
+};
+
+
+
+/**
+ *  @brief  register field
+ *
+ *  @tparam R           register, #Reg
+ *  @tparam Msb         most significant bit
+ *  @tparam Lsb         least significant bit
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+template <class R, unsigned Msb, unsigned Lsb>
+struct Field {
+    static_assert((Lsb <= Msb) && (Msb < 8 * R::bytes), "field exceeds register");
+
+    using reg = R;                                          /**< register of field */
+    using value_type = typename R::value_type;              /**< register value */
+    static constexpr unsigned   pos = Lsb;                  /**< field position */
+    static constexpr value_type msk = static_cast<value_type>((~static_cast<uint64_t>(0) >> (63 - (Msb - Lsb))) << Lsb);   /**< field mask in register */
+
+    /** field from register value */
+    static constexpr value_type get( value_type val )
+    {
+        return static_cast<value_type>((val & msk) >> pos);
+    }
+
+    /** register value with replaced field */
+    static constexpr value_type set( value_type val, value_type fld )
+    {
+        return static_cast<value_type>((val & ~msk) | ((fld << pos) & msk));
+    }
+};
+
+
+
+/**
+ *  @brief  burst
+ *
+ *  registers of one slave without gap in ascending order, the register
+ *  address auto-increments by one per stride data bytes
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+template <class R0, class... Rs>
+struct Burst {
+    /** all registers adjacent and readable */
+    static constexpr bool adjacent()
+    {
+        constexpr uint8_t  adr7[] = {R0::adr7, Rs::adr7...};
+        constexpr uint32_t addr[] = {R0::addr, Rs::addr...};
+        constexpr uint8_t  stride[] = {R0::stride, Rs::stride...};
+        constexpr uint32_t span[] = {R0::span, Rs::span...};
+        constexpr uint8_t  bytes[] = {R0::bytes, Rs::bytes...};
+        constexpr Access   acc[] = {R0::access, Rs::access...};
+        for ( size_t i = 0; i < sizeof(addr) / sizeof(addr[0]); i++ ) {
+            if ( (Access::WO == acc[i]) || (0 == stride[i]) ) {
+                return false;
+            }
+            if ( (0 != i) && ((adr7[i] != adr7[0]) || (addr[i] != addr[i-1] + span[i-1]) || (bytes[i-1] != span[i-1] * stride[i-1])) ) {
+                return false;   // a partly used address would shift the following registers
+            }
+        }
+        return true;
+    }
+    static constexpr size_t bytes = (R0::bytes + ... + Rs::bytes);     /**< burst length */
+};
+
+
+
+/**
+ *  @brief  read
+ *
+ *  reads register with repeated start
+ *
+ *  @tparam         R                   register, #Reg
+ *  @param[in,out]  usbiss              opened USB-ISS
+ *  @param[out]     val                 register value
+ *  @return         int                 see #usbiss_i2c_xfer
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+template <class R>
+inline int read( t_usbiss* usbiss, typename R::value_type& val )
+{
+    static_assert(Access::WO != R::access, "register is write only");
+    std::array<uint8_t, R::adrBytes> wr = R::frame();
+    std::array<uint8_t, R::bytes> rd;
+    t_usbiss_i2c_xfer xfer = {R::adr7, wr.data(), wr.size(), rd.data(), rd.size(), 0};
+    int intRet = usbiss_i2c_xfer(usbiss, &xfer);
+    if ( 0 == intRet ) {
+        val = R::unpack(rd.data());
+    }
+    return intRet;
+}
+
+
+
+/**
+ *  @brief  register of pack
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+template <size_t I, class... Rs>
+using RegAt = std::tuple_element_t<I, std::tuple<Rs...>>;
+
+
+
+/**
+ *  @brief  registers adjacent
+ *
+ *  @tparam         I                   first register
+ *  @tparam         Rs                  registers, #Reg
+ *  @return         bool                registers I..I+K form a #Burst
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+template <size_t I, class... Rs, size_t... K>
+constexpr bool adjacent_from( std::index_sequence<K...> )
+{
+    return Burst<RegAt<I + K, Rs...>...>::adjacent();
+}
+
+
+
+/**
+ *  @brief  burst length
+ *
+ *  number of registers from index I on which are read in one burst, at
+ *  least one
+ *
+ *  @tparam         I                   first register
+ *  @tparam         N                   already adjacent registers
+ *  @tparam         Rs                  registers, #Reg
+ *  @return         size_t              number of registers
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+template <size_t I, size_t N, class... Rs>
+constexpr size_t burst_len()
+{
+    if constexpr ( I + N < sizeof...(Rs) ) {
+        if constexpr ( adjacent_from<I, Rs...>(std::make_index_sequence<N + 1>{}) ) {
+            return burst_len<I, N + 1, Rs...>();
+        } else {
+            return N;
+        }
+    } else {
+        return N;
+    }
+}
+
+
+
+/**
+ *  @brief  read burst
+ *
+ *  reads registers I..I+K of pack, one register with #read, several in one
+ *  burst
+ *
+ *  @tparam         I                   first register
+ *  @tparam         Rs                  registers, #Reg
+ *  @param[in,out]  usbiss              opened USB-ISS
+ *  @param[out]     vals                references to register values
+ *  @return         int                 see #usbiss_i2c_xfer
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+template <size_t I, class... Rs, class Vals, size_t... K>
+inline int read_burst( t_usbiss* usbiss, Vals& vals, std::index_sequence<K...> )
+{
+    using R0 = RegAt<I, Rs...>;
+    if constexpr ( 1 == sizeof...(K) ) {
+        return read<R0>(usbiss, std::get<I>(vals));
+    } else {
+        std::array<uint8_t, R0::adrBytes> wr = R0::frame();
+        std::array<uint8_t, Burst<RegAt<I + K, Rs...>...>::bytes> rd;
+        t_usbiss_i2c_xfer xfer = {R0::adr7, wr.data(), wr.size(), rd.data(), rd.size(), 0};
+        int intRet = usbiss_i2c_xfer(usbiss, &xfer);
+        if ( 0 == intRet ) {
+            size_t ofs = 0;
+            ((std::get<I + K>(vals) = RegAt<I + K, Rs...>::unpack(rd.data() + ofs), ofs += RegAt<I + K, Rs...>::bytes), ...);
+        }
+        return intRet;
+    }
+}
+
+
+
+/**
+ *  @brief  read from
+ *
+ *  reads registers from index I on, the longest adjacent run is one burst
+ *
+ *  @tparam         I                   first register
+ *  @tparam         Rs                  registers, #Reg
+ *  @param[in,out]  usbiss              opened USB-ISS
+ *  @param[out]     vals                references to register values
+ *  @return         int                 see #usbiss_i2c_xfer
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+template <size_t I, class... Rs, class Vals>
+inline int read_from( t_usbiss* usbiss, Vals& vals )
+{
+    if constexpr ( I == sizeof...(Rs) ) {
+        return 0;
+    } else {
+        constexpr size_t num = burst_len<I, 1, Rs...>();
+        int intRet = read_burst<I, Rs...>(usbiss, vals, std::make_index_sequence<num>{});
+        return (0 != intRet) ? intRet : read_from<I + num, Rs...>(usbiss, vals);
+    }
+}
+
+
+
+/**
+ *  @brief  read registers
+ *
+ *  reads several registers in given order, every run of adjacent registers
+ *  of one slave is read in one burst
+ *
+ *  @tparam         R0, Rs              registers, #Reg
+ *  @param[in,out]  usbiss              opened USB-ISS
+ *  @param[out]     v0, vs              register values
+ *  @return         int                 see #usbiss_i2c_xfer
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+template <class R0, class R1, class... Rs>
+inline int read( t_usbiss* usbiss, typename R0::value_type& v0, typename R1::value_type& v1, typename Rs::value_type&... vs )
+{
+    std::tuple<typename R0::value_type&, typename R1::value_type&, typename Rs::value_type&...> vals(v0, v1, vs...);
+    return read_from<0, R0, R1, Rs...>(usbiss, vals);
+}
+
+
+
+/**
+ *  @brief  write
+ *
+ *  writes register, register address part of frame is constant
+ *
+ *  @tparam         R                   register, #Reg
+ *  @param[in,out]  usbiss              opened USB-ISS
+ *  @param[in]      val                 register value
+ *  @return         int                 see #usbiss_i2c_wr
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+template <class R>
+inline int write( t_usbiss* usbiss, typename R::value_type val )
+{
+    static_assert(Access::RO != R::access, "register is read only");
+    constexpr std::array<uint8_t, R::adrBytes> adr = R::frame();
+    std::array<uint8_t, R::adrBytes + R::bytes> wr;
+    for ( size_t i = 0; i < R::adrBytes; i++ ) {
+        wr[i] = adr[i];
+    }
+    R::pack(val, wr.data() + R::adrBytes);
+    return usbiss_i2c_wr(usbiss, R::adr7, wr.data(), wr.size());
+}
+
+
+
+/**
+ *  @brief  field read
+ *
+ *  @tparam         F                   field, #Field
+ *  @param[in,out]  usbiss              opened USB-ISS
+ *  @param[out]     fld                 field value
+ *  @return         int                 see #usbiss_i2c_xfer
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+template <class F>
+inline int get( t_usbiss* usbiss, typename F::value_type& fld )
+{
+    typename F::value_type val;
+    int intRet = read<typename F::reg>(usbiss, val);
+    if ( 0 == intRet ) {
+        fld = F::get(val);
+    }
+    return intRet;
+}
+
+
+
+/**
+ *  @brief  field write
+ *
+ *  read-modify-write of field, write only registers are written with the
+ *  other fields zero
+ *
+ *  @tparam         F                   field, #Field
+ *  @param[in,out]  usbiss              opened USB-ISS
+ *  @param[in]      fld                 field value
+ *  @return         int                 see #usbiss_i2c_wr
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+template <class F>
+inline int set( t_usbiss* usbiss, typename F::value_type fld )
+{
+    typename F::value_type val = 0;
+    if constexpr ( Access::WO != F::reg::access ) {
+        int intRet = read<typename F::reg>(usbiss, val);
+        if ( 0 != intRet ) {
+            return intRet;
+        }
+    }
+    return write<typename F::reg>(usbiss, F::set(val, fld));
+}
+
+
+}   // namespace regmap
+}   // namespace usbiss
+
+
+#endif // __USB_ISS_REGMAP_HPP
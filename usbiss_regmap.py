@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+# ***********************************************************************
+# @copyright    : Siemens AG
+# @license      : GPLv3
+# @author       : Andreas Kaeberlein
+# @address      : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+#
+# @maintainer   : Andreas Kaeberlein
+# @telephone    : +49 371 4810-2108
+# @email        : andreas.kaeberlein@siemens.com
+#
+# @file         : usbiss_regmap.py
+# @date         : 2026-10-18
+# @see          : https://github.com/andkae/usbiss
+#
+# @brief        : Register map compiler
+#                 reads register map as CSV, f.e. exported from a
+#                 spreadsheet, and generates:
+#                   * <name>_regmap.h   : C defines and accessors
+#                   * <name>_regmap.hpp : C++ types for usbiss_regmap.hpp
+#
+#                 CSV records, first column selects type, '#' comments:
+#                   device,<name>,<adr7>,<adr bytes>[,big|little[,<stride>]]
+#                   register,<name>,<addr>,<bytes>,<ro|wo|rw>
+#                   field,<register>,<name>,<msb>,<lsb>
+#
+# **********************************************************************/
+
+
+import argparse
+import csv
+import os
+import sys
+
+
+ACCESS = {"ro": "RO", "wo": "WO", "rw": "RW"}
+
+
+class RegmapError(Exception):
+    """register map description error"""
+
+
+def to_int(val, what, line):
+    """converts decimal or hex number"""
+    try:
+        return int(val.strip(), 0)
+    except ValueError:
+        raise RegmapError("line %d: %s '%s' is not a number" % (line, what, val))
+
+
+def c_type(num):
+    """smallest unsigned C type of num bytes"""
+    for bytes_, typ in ((1, "uint8_t"), (2, "uint16_t"), (4, "uint32_t")):
+        if num <= bytes_:
+            return typ
+    return "uint64_t"
+
+
+def parse(path):
+    """reads register map, returns device dict"""
+    dev = None
+    regs = {}
+    with open(path, newline="") as fh:
+        for line, row in enumerate(csv.reader(fh), start=1):
+            row = [col.strip() for col in row]
+            if not row or not row[0] or row[0].startswith("#"):
+                continue
+            kind = row[0].lower()
+            if "device" == kind:
+                if dev is not None or len(row) < 4:
+                    raise RegmapError("line %d: one 'device,<name>,<adr7>,<adr bytes>[,big|little[,<stride>]]' expected" % line)
+                dev = {
+                    "name": row[1],
+                    "adr7": to_int(row[2], "I2C address", line),
+                    "adrBytes": to_int(row[3], "register address bytes", line),
+                    "bigEndian": (len(row) < 5) or ("" == row[4]) or ("big" == row[4].lower()),
+                    "stride": to_int(row[5], "address stride", line) if (len(row) > 5) and ("" != row[5]) else 1,
+                    "regs": [],
+                }
+                if not (0 <= dev["adr7"] <= 0x7f) or not (1 <= dev["adrBytes"] <= 4) or not (0 <= dev["stride"] <= 8):
+                    raise RegmapError("line %d: I2C address 0..0x7f, 1..4 register address bytes and stride 0..8 expected" % line)
+            elif "register" == kind:
+                if dev is None or len(row) < 5 or row[4].lower() not in ACCESS:
+                    raise RegmapError("line %d: 'register,<name>,<addr>,<bytes>,<ro|wo|rw>' after device expected" % line)
+                reg = {
+                    "name": row[1],
+                    "addr": to_int(row[2], "register address", line),
+                    "bytes": to_int(row[3], "register width", line),
+                    "access": ACCESS[row[4].lower()],
+                    "fields": [],
+                }
+                if reg["name"] in regs:
+                    raise RegmapError("line %d: register '%s' defined twice" % (line, reg["name"]))
+                if not (1 <= reg["bytes"] <= 8) or not (0 <= reg["addr"] < (1 << (8 * dev["adrBytes"]))):
+                    raise RegmapError("line %d: register '%s' width 1..8 bytes and address in range expected" % (line, reg["name"]))
+                regs[reg["name"]] = reg
+                dev["regs"].append(reg)
+            elif "field" == kind:
+                if len(row) < 5 or row[1] not in regs:
+                    raise RegmapError("line %d: 'field,<register>,<name>,<msb>,<lsb>' of defined register expected" % line)
+                reg = regs[row[1]]
+                fld = {"name": row[2], "msb": to_int(row[3], "msb", line), "lsb": to_int(row[4], "lsb", line)}
+                if not (0 <= fld["lsb"] <= fld["msb"] < 8 * reg["bytes"]):
+                    raise RegmapError("line %d: field '%s' exceeds register '%s'" % (line, fld["name"], reg["name"]))
+                if any(f["name"] == fld["name"] for f in reg["fields"]):
+                    raise RegmapError("line %d: field '%s' defined twice" % (line, fld["name"]))
+                reg["fields"].append(fld)
+            else:
+                raise RegmapError("line %d: unknown record '%s'" % (line, row[0]))
+    if dev is None:
+        raise RegmapError("no device record")
+    # overlapping registers
+    last = None
+    for reg in sorted(dev["regs"], key=lambda r: r["addr"]):
+        if last is not None and reg["addr"] < last["addr"] + span(dev, last):
+            raise RegmapError("register '%s' overlaps '%s'" % (reg["name"], last["name"]))
+        last = reg
+    return dev
+
+
+def span(dev, reg):
+    """number of register addresses covered by register"""
+    if 0 == dev["stride"]:
+        return 1    # pointer register, one address per register
+    return (reg["bytes"] + dev["stride"] - 1) // dev["stride"]
+
+
+def define(name, val, doc=None):
+    """aligned C define"""
+    line = "#define %-39s (%s)" % (name, val)
+    return line if doc is None else "%-56s /**< %s */" % (line, doc)
+
+
+def gen_h(dev, src):
+    """C header"""
+    pfx = dev["name"].upper()
+    low = dev["name"].lower()
+    guard = "__%s_REGMAP_H" % pfx
+    out = []
+    out.append("/* generated by usbiss_regmap.py from %s, do not edit */" % os.path.basename(src))
+    out.append("")
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("")
+    out.append("/** Includes **/")
+    out.append("#include <stddef.h>     // size_t")
+    out.append("#include <stdint.h>     // fixed data types")
+    out.append("#include \"usbiss.h\"     // USBISS driver")
+    out.append("")
+    out.append("")
+    out.append(define("%s_ADR7" % pfx, "0x%02x" % dev["adr7"], "Seven Bit I2C address"))
+    out.append(define("%s_ADR_BYTES" % pfx, dev["adrBytes"], "number of register address bytes"))
+    out.append(define("%s_STRIDE" % pfx, dev["stride"], "data bytes per register address, 0: no auto-increment"))
+    for reg in dev["regs"]:
+        name = "%s_%s" % (pfx, reg["name"].upper())
+        typ = c_type(reg["bytes"])
+        out.append("")
+        out.append("")
+        out.append("/* %s, %s */" % (reg["name"], reg["access"].lower()))
+        out.append(define(name, "0x%02x" % reg["addr"], "register address"))
+        out.append(define("%s_LEN" % name, reg["bytes"], "register width in bytes"))
+        for fld in reg["fields"]:
+            msk = ((1 << (fld["msb"] - fld["lsb"] + 1)) - 1) << fld["lsb"]
+            out.append(define("%s_%s_POS" % (name, fld["name"].upper()), fld["lsb"], "field position"))
+            out.append(define("%s_%s_MSK" % (name, fld["name"].upper()), "0x%x" % msk, "field mask"))
+        adr = ", ".join("0x%02x" % ((reg["addr"] >> (8 * (dev["adrBytes"] - 1 - i))) & 0xff) for i in range(dev["adrBytes"]))
+        order = [(reg["bytes"] - 1 - i) if dev["bigEndian"] else i for i in range(reg["bytes"])]
+        if "WO" != reg["access"]:
+            out.append("")
+            out.append("static inline int %s_%s_rd( t_usbiss *usbiss, %s *val )" % (low, reg["name"].lower(), typ))
+            out.append("{")
+            out.append("    uint8_t uint8Wr[%d] = {%s};" % (dev["adrBytes"], adr))
+            out.append("    uint8_t uint8Rd[%d];" % reg["bytes"])
+            out.append("    t_usbiss_i2c_xfer xfer = {%s_ADR7, uint8Wr, sizeof(uint8Wr), uint8Rd, sizeof(uint8Rd), 0};" % pfx)
+            out.append("    int intRet = usbiss_i2c_xfer(usbiss, &xfer);")
+            out.append("    if ( 0 == intRet ) {")
+            terms = " | ".join("((%s) uint8Rd[%d] << %d)" % (typ, i, 8 * s) if s else "(%s) uint8Rd[%d]" % (typ, i) for i, s in enumerate(order))
+            out.append("        *val = (%s) (%s);" % (typ, terms))
+            out.append("    }")
+            out.append("    return intRet;")
+            out.append("}")
+        if "RO" != reg["access"]:
+            out.append("")
+            out.append("static inline int %s_%s_wr( t_usbiss *usbiss, %s val )" % (low, reg["name"].lower(), typ))
+            out.append("{")
+            data = ", ".join("(uint8_t) (val >> %d)" % (8 * s) if s else "(uint8_t) val" for s in order)
+            out.append("    uint8_t uint8Wr[%d] = {%s, %s};" % (dev["adrBytes"] + reg["bytes"], adr, data))
+            out.append("    return usbiss_i2c_wr(usbiss, %s_ADR7, uint8Wr, sizeof(uint8Wr));" % pfx)
+            out.append("}")
+    out.append("")
+    out.append("")
+    out.append("#endif // %s" % guard)
+    return "\n".join(out) + "\n"
+
+
+def gen_hpp(dev, src):
+    """C++ header"""
+    pfx = dev["name"].upper()
+    low = dev["name"].lower()
+    guard = "__%s_REGMAP_HPP" % pfx
+    out = []
+    out.append("/* generated by usbiss_regmap.py from %s, do not edit */" % os.path.basename(src))
+    out.append("")
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("")
+    out.append("/** Includes **/")
+    out.append("#include \"usbiss_regmap.hpp\"  // register accessors")
+    out.append("#include \"%s_regmap.h\"  // register addresses" % low)
+    out.append("")
+    out.append("")
+    out.append("namespace %s {" % low)
+    out.append("")
+    out.append("using usbiss::regmap::Access;")
+    out.append("")
+    for reg in dev["regs"]:
+        name = "%s_%s" % (pfx, reg["name"].upper())
+        out.append("using %s = usbiss::regmap::Reg<%s_ADR7, %s_ADR_BYTES, %s, %s_LEN, Access::%s, %s, %s_STRIDE>;"
+                   % (reg["name"].upper(), pfx, pfx, name, name, reg["access"], "true" if dev["bigEndian"] else "false", pfx))
+        for fld in reg["fields"]:
+            out.append("using %s_%s = usbiss::regmap::Field<%s, %d, %d>;"
+                       % (reg["name"].upper(), fld["name"].upper(), reg["name"].upper(), fld["msb"], fld["lsb"]))
+    out.append("")
+    out.append("}   // namespace %s" % low)
+    out.append("")
+    out.append("")
+    out.append("#endif // %s" % guard)
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="USB-ISS register map compiler")
+    parser.add_argument("map", help="register map CSV")
+    parser.add_argument("-o", "--outdir", default=".", help="output directory")
+    args = parser.parse_args()
+    try:
+        dev = parse(args.map)
+    except (OSError, RegmapError) as ero:
+        print("[ FAIL ]   %s: %s" % (args.map, ero))
+        return 1
+    for ext, gen in ((".h", gen_h), (".hpp", gen_hpp)):
+        path = os.path.join(args.outdir, "%s_regmap%s" % (dev["name"].lower(), ext))
+        with open(path, "w") as fh:
+            fh.write(gen(dev, args.map))
+        print("[ OKAY ]   %s" % path)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,456 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_sched.c
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS periodic scheduler
+                  polls register reads of many I2C slaves at individual
+                  rates through one USB-ISS:
+                    * earliest deadline first
+                    * due reads of one slave packed into one burst
+                    * bursts of many slaves packed into shared frames
+                    * timestamped results by callback
+                    * deadline miss statistic
+***********************************************************************/
+
+
+
+/** Includes **/
+/* Standard libs */
+#include <stdio.h>      // f.e. printf
+#include <stdint.h>     // defines fixed data types, like int8_t...
+#include <string.h>     // memset
+#include <stdlib.h>     // realloc
+#if defined(_WIN32)
+    #include <windows.h>    // QueryPerformanceCounter
+#else
+    #include <time.h>       // clock_gettime
+#endif
+/** self **/
+#include "usbiss.h"         // USBISS driver
+#include "usbiss_sched.h"   // some defs
+
+
+
+/**
+ *  @brief monotonic time
+ *
+ *  @return         uint64_t            time in us
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint64_t usbiss_sched_time_us( void )
+{
+#if defined(_WIN32)
+    LARGE_INTEGER   cnt, frq;
+    QueryPerformanceCounter(&cnt);
+    QueryPerformanceFrequency(&frq);
+    return (uint64_t) ((cnt.QuadPart / frq.QuadPart) * 1000000 + ((cnt.QuadPart % frq.QuadPart) * 1000000) / frq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) ts.tv_nsec / 1000;
+#endif
+}
+
+
+
+/**
+ *  @brief sleep
+ *
+ *  @param[in]      us                  sleep time in us
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_sched_sleep_us( uint32_t us )
+{
+#if defined(_WIN32)
+    Sleep((DWORD) ((us + 999) / 1000));
+#else
+    struct timespec ts;
+    ts.tv_sec = (time_t) (us / 1000000);
+    ts.tv_nsec = (long) ((us % 1000000) * 1000);
+    nanosleep(&ts, NULL);
+#endif
+}
+
+
+
+/**
+ *  @brief job deadline
+ *
+ *  @param[in]      job                 job
+ *  @return         uint64_t            deadline of current release in us
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint64_t usbiss_sched_deadline( const t_usbiss_sched_job *job )
+{
+    return job->uint64Release + ((0 != job->uint32DeadlineUs) ? job->uint32DeadlineUs : job->uint32PeriodUs);
+}
+
+
+
+/**
+ *  @brief job joinable
+ *
+ *  checks if job can be added to transfer
+ *
+ *  @param[in]      job                 job
+ *  @param[in]      adr7                Seven Bit I2C address of transfer
+ *  @param[in]      adrBytes            register address bytes of transfer
+ *  @param[in,out]  lo                  first register of transfer, extended if joined
+ *  @param[in,out]  hi                  behind last register of transfer, extended if joined
+ *  @param[in,out]  gap                 bridgeable registers of transfer, -1: only identical reads, limited by job if joined
+ *  @return         int
+ *  @retval         1                   joined
+ *  @retval         0                   not joinable
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_sched_join( const t_usbiss_sched_job *job, uint8_t adr7, uint8_t adrBytes, uint64_t *lo, uint64_t *hi, int8_t *gap )
+{
+    /** Variables **/
+    uint64_t    start = job->uint32Reg;                             // first register of job
+    uint64_t    end = start + job->uint16Len;                       // behind last register of job
+    int8_t      int8Gap = (int8_t) usbiss_min(job->int8Gap, *gap);  // bridgeable registers
+
+    if ( (adr7 != job->uint8Adr7) || (adrBytes != job->uint8AdrBytes) ) {
+        return 0;
+    }
+    /* same read, no assumption about register addressing */
+    if ( (start == *lo) && (end == *hi) ) {
+        *gap = int8Gap;
+        return 1;
+    }
+    if ( 0 > int8Gap ) {
+        return 0;
+    }
+    if ( (start > *hi + (uint64_t) int8Gap) || (end + (uint64_t) int8Gap < *lo) ) {
+        return 0;
+    }
+    if ( usbiss_max(end, *hi) - usbiss_min(start, *lo) > USBISS_SCHED_BURST ) {
+        return 0;
+    }
+    *lo = usbiss_min(start, *lo);
+    *hi = usbiss_max(end, *hi);
+    *gap = int8Gap;
+    return 1;
+}
+
+
+
+/**
+ *  usbiss_sched_init
+ *    initializes scheduler
+ */
+int usbiss_sched_init( t_usbiss_sched *self, t_usbiss *usbiss )
+{
+    memset(self, 0, sizeof(*self));
+    self->usbiss = usbiss;
+    self->uint64Epoch = usbiss_sched_time_us();
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_sched_add
+ *    registers periodic register read
+ */
+int usbiss_sched_add( t_usbiss_sched *self, uint8_t adr7, uint8_t adrBytes, uint32_t reg, uint16_t len, uint32_t periodUs, uint32_t deadlineUs, t_usbiss_sched_cb cb, void* arg )
+{
+    /** Variables **/
+    t_usbiss_sched_job* job;        // job list
+    size_t*             due;        // deadline order
+    size_t              idx;        // index of new job
+
+    /* check */
+    if ( (adr7 >= USBISS_I2C_NUM_ADR) || (1 > adrBytes) || (4 < adrBytes) || (0 == len) || (len > USBISS_SCHED_BURST) || (0 == periodUs) || (NULL == cb) ) {
+        if ( 0 != self->usbiss->uint8MsgLevel ) {
+            printf("  ERROR:%s: adr=0x%02x, adrBytes=%u, len=%u, period=%uus unsupported\n", __FUNCTION__, adr7, adrBytes, len, periodUs);
+        }
+        return -1;
+    }
+    /* reuse removed job */
+    for ( idx = 0; idx < self->num; idx++ ) {
+        if ( 0 == self->job[idx].uint8Used ) {
+            break;
+        }
+    }
+    if ( idx == self->num ) {
+        job = realloc(self->job, (self->num + 1) * sizeof(t_usbiss_sched_job));
+        if ( NULL == job ) {
+            return -1;
+        }
+        self->job = job;
+        due = realloc(self->due, (self->num + 1) * sizeof(size_t));
+        if ( NULL == due ) {
+            return -1;
+        }
+        self->due = due;
+        ++(self->num);      // transfers grow in next cycle, delivered data stays valid if called from callback
+    }
+    /* new job */
+    job = &self->job[idx];
+    memset(job, 0, sizeof(*job));
+    job->uint8Used = 1;
+    job->uint8Adr7 = adr7;
+    job->uint8AdrBytes = adrBytes;
+    job->uint32Reg = reg;
+    job->uint16Len = len;
+    job->uint32PeriodUs = periodUs;
+    job->uint32DeadlineUs = deadlineUs;
+    job->int8Gap = -1;
+    job->cb = cb;
+    job->arg = arg;
+    job->uint64Release = self->uint64Epoch + ((usbiss_sched_time_us() - self->uint64Epoch + periodUs - 1) / periodUs) * periodUs;
+    return (int) idx;
+}
+
+
+
+/**
+ *  usbiss_sched_gap
+ *    allows reading unrequested registers to join jobs
+ */
+int usbiss_sched_gap( t_usbiss_sched *self, size_t job, uint8_t gap )
+{
+    if ( (job >= self->num) || (0 == self->job[job].uint8Used) || (gap > USBISS_SCHED_GAP) ) {
+        if ( 0 != self->usbiss->uint8MsgLevel ) {
+            printf("  ERROR:%s: job=%zu, gap=%u unsupported\n", __FUNCTION__, job, gap);
+        }
+        return -1;
+    }
+    self->job[job].int8Gap = (int8_t) gap;
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_sched_remove
+ *    removes job
+ */
+void usbiss_sched_remove( t_usbiss_sched *self, size_t job )
+{
+    if ( job < self->num ) {
+        self->job[job].uint8Used = 0;
+    }
+}
+
+
+
+/**
+ *  usbiss_sched_cycle
+ *    reads due jobs, packed and in deadline order
+ */
+int usbiss_sched_cycle( t_usbiss_sched *self, uint32_t *sleepUs )
+{
+    /** Variables **/
+    t_usbiss_sched_job* job;                        // current job
+    t_usbiss_sched_res  res;                        // job result
+    t_usbiss_i2c_xfer*  xfer;                       // current transfer
+    uint8_t*            uint8Wr;                    // register address of transfer
+    uint64_t            uint64Now;                  // current time
+    uint64_t            uint64Skip;                 // passed releases
+    uint64_t            uint64Next = UINT64_MAX;    // earliest release after cycle
+    uint64_t            lo;                         // first register of transfer
+    uint64_t            hi;                         // behind last register of transfer
+    uint8_t             uint8Join;                  // transfer extended
+    int8_t              int8Gap;                    // bridgeable registers of transfer
+    size_t              numDue = 0;                 // number of due jobs
+    size_t              numXfer = 0;                // number of transfers
+    size_t              tmp;                        // sort swap
+    int                 intRet = 0;                 // cycle result
+
+    /* transfers for jobs added since last cycle */
+    if ( self->numXfer < self->num ) {
+        xfer = realloc(self->xfer, self->num * sizeof(t_usbiss_i2c_xfer));
+        if ( NULL == xfer ) {
+            return -1;
+        }
+        self->xfer = xfer;
+        uint8Wr = realloc(self->uint8PtrBuf, self->num * (4 + USBISS_SCHED_BURST));
+        if ( NULL == uint8Wr ) {
+            return -1;
+        }
+        self->uint8PtrBuf = uint8Wr;
+        self->numXfer = self->num;
+    }
+    /* due jobs, behind ones skip passed releases */
+    uint64Now = usbiss_sched_time_us();
+    for ( size_t i = 0; i < self->num; i++ ) {
+        job = &self->job[i];
+        job->uint8Pack = 0;
+        if ( (0 == job->uint8Used) || (job->uint64Release > uint64Now) ) {
+            continue;
+        }
+        uint64Skip = (uint64Now - job->uint64Release) / job->uint32PeriodUs;
+        if ( 0 != uint64Skip ) {
+            job->uint64Release += uint64Skip * job->uint32PeriodUs;
+            job->uint32Miss += (uint32_t) uint64Skip;
+            self->uint32Miss += (uint32_t) uint64Skip;
+        }
+        self->due[numDue++] = i;
+    }
+    /* earliest deadline first, insertion sort, job lists are short */
+    for ( size_t i = 1; i < numDue; i++ ) {
+        for ( size_t j = i; (j > 0) && (usbiss_sched_deadline(&self->job[self->due[j-1]]) > usbiss_sched_deadline(&self->job[self->due[j]])); j-- ) {
+            tmp = self->due[j];
+            self->due[j] = self->due[j-1];
+            self->due[j-1] = tmp;
+        }
+    }
+    if ( 0 != numDue ) {
+        ++(self->uint32Cycles);
+    }
+    /* transfers, each started by most urgent unassigned job */
+    for ( size_t i = 0; i < numDue; i++ ) {
+        job = &self->job[self->due[i]];
+        if ( 0 != job->uint8Pack ) {
+            continue;
+        }
+        job->uint8Pack = 1;
+        lo = job->uint32Reg;
+        hi = lo + job->uint16Len;
+        int8Gap = job->int8Gap;
+        do {    // joined jobs can bridge to further jobs
+            uint8Join = 0;
+            for ( size_t j = i + 1; j < numDue; j++ ) {
+                if ( (0 == self->job[self->due[j]].uint8Pack) && (0 != usbiss_sched_join(&self->job[self->due[j]], job->uint8Adr7, job->uint8AdrBytes, &lo, &hi, &int8Gap)) ) {
+                    self->job[self->due[j]].uint8Pack = 1;
+                    uint8Join = 1;
+                }
+            }
+        } while ( 0 != uint8Join );
+        /* packed read */
+        xfer = &self->xfer[numXfer];
+        uint8Wr = self->uint8PtrBuf + numXfer * (4 + USBISS_SCHED_BURST);
+        for ( uint8_t k = 0; k < job->uint8AdrBytes; k++ ) {
+            uint8Wr[k] = (uint8_t) (lo >> (8 * (job->uint8AdrBytes - 1 - k)));
+        }
+        xfer->uint8Adr7 = job->uint8Adr7;
+        xfer->wr = uint8Wr;
+        xfer->wrLen = job->uint8AdrBytes;
+        xfer->rd = uint8Wr + 4;
+        xfer->rdLen = (size_t) (hi - lo);
+        /* assign jobs of transfer */
+        for ( size_t j = i; j < numDue; j++ ) {
+            if ( 1 == self->job[self->due[j]].uint8Pack ) {
+                self->job[self->due[j]].uint8Pack = 2;  // assigned
+                self->job[self->due[j]].xfer = numXfer;
+                self->job[self->due[j]].uint16Ofs = (uint16_t) (self->job[self->due[j]].uint32Reg - lo);
+            }
+        }
+        ++numXfer;
+    }
+    /* short reads of different slaves share frames */
+    usbiss_i2c_xfer_pack(self->usbiss, self->xfer, numXfer);
+    res.uint64Us = usbiss_sched_time_us();
+    self->uint32Xfer += (uint32_t) numXfer;
+    for ( size_t i = 0; i < numXfer; i++ ) {
+        if ( 0 != self->xfer[i].intRet ) {
+            if ( 0 != self->usbiss->uint8MsgLevel ) {
+                printf("  ERROR:%s: adr=0x%02x, len=%zu, ero=0x%x\n", __FUNCTION__, self->xfer[i].uint8Adr7, self->xfer[i].rdLen, self->xfer[i].intRet);
+            }
+            intRet = -1;
+        }
+    }
+    /* deliver in deadline order, callbacks can add jobs */
+    for ( size_t i = 0; i < numDue; i++ ) {
+        job = &self->job[self->due[i]];
+        if ( 2 != job->uint8Pack ) {
+            continue;   // slot reused by callback
+        }
+        xfer = &self->xfer[job->xfer];
+        res.job = self->due[i];
+        res.uint64Release = job->uint64Release;
+        res.intRet = xfer->intRet;
+        res.uint8Miss = (uint8_t) (res.uint64Us > usbiss_sched_deadline(job));
+        res.data = (const uint8_t*) xfer->rd + job->uint16Ofs;
+        res.uint16Len = job->uint16Len;
+        ++(job->uint32Runs);
+        ++(self->uint32Runs);
+        if ( 0 != res.uint8Miss ) {
+            ++(job->uint32Miss);
+            ++(self->uint32Miss);
+        }
+        if ( 0 != xfer->intRet ) {
+            ++(job->uint32Ero);
+        }
+        job->uint64Release += job->uint32PeriodUs;
+        job->cb(job->arg, &res);
+    }
+    /* next release */
+    for ( size_t i = 0; i < self->num; i++ ) {
+        if ( 0 != self->job[i].uint8Used ) {
+            uint64Next = usbiss_min(uint64Next, self->job[i].uint64Release);
+        }
+    }
+    if ( NULL != sleepUs ) {
+        uint64Now = usbiss_sched_time_us();
+        *sleepUs = (uint64Next > uint64Now) ? (uint32_t) usbiss_min(uint64Next - uint64Now, (uint64_t) UINT32_MAX) : 0;
+    }
+    return (0 != intRet) ? intRet : (int) numXfer;
+}
+
+
+
+/**
+ *  usbiss_sched_run
+ *    performs cycles until duration elapsed or stop
+ */
+int usbiss_sched_run( t_usbiss_sched *self, uint64_t durationUs, volatile int *stop )
+{
+    /** Variables **/
+    uint64_t    uint64End = usbiss_sched_time_us() + durationUs;    // run end
+    uint32_t    uint32Sleep;    // time to next release
+    uint8_t     uint8Jobs = 0;  // active jobs available
+
+    for ( size_t i = 0; i < self->num; i++ ) {
+        uint8Jobs |= self->job[i].uint8Used;
+    }
+    if ( 0 == uint8Jobs ) {
+        if ( 0 != self->usbiss->uint8MsgLevel ) {
+            printf("  ERROR:%s: no jobs\n", __FUNCTION__);
+        }
+        return -1;
+    }
+    while ( ((NULL == stop) || (0 == *stop)) && ((0 == durationUs) || (usbiss_sched_time_us() < uint64End)) ) {
+        usbiss_sched_cycle(self, &uint32Sleep);     // transfer errors are reported per job
+        if ( 0 != uint32Sleep ) {
+            usbiss_sched_sleep_us(usbiss_min(uint32Sleep, (uint32_t) USBISS_SCHED_SLEEP_US));
+        }
+    }
+    return 0;
+}
+
+
+
+/**
+ *  usbiss_sched_free
+ *    releases jobs
+ */
+void usbiss_sched_free( t_usbiss_sched *self )
+{
+    free(self->job);
+    free(self->due);
+    free(self->xfer);
+    free(self->uint8PtrBuf);
+    self->job = NULL;
+    self->due = NULL;
+    self->xfer = NULL;
+    self->uint8PtrBuf = NULL;
+    self->num = 0;
+    self->numXfer = 0;
+}
@@ -0,0 +1,298 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_sched.h
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS periodic scheduler
+                  polls register reads of many I2C slaves at individual
+                  rates through one USB-ISS:
+                    * earliest deadline first
+                    * due reads of one slave packed into one burst
+                    * bursts of many slaves packed into shared frames
+                    * timestamped results by callback
+                    * deadline miss statistic
+***********************************************************************/
+
+
+
+// Define Guard
+#ifndef __USB_ISS_SCHED_H
+#define __USB_ISS_SCHED_H
+
+
+/** Includes **/
+#include <stddef.h>     // size_t
+#include <stdint.h>     // defines fixed data types, like int8_t...
+#include "usbiss.h"     // USBISS driver
+
+
+
+/**
+ *  @defgroup USBISS_SCHED
+ *  Scheduler
+ *
+ *  @{
+ */
+#define USBISS_SCHED_BURST      (64)    /**< maximum read bytes of one packed transfer */
+#define USBISS_SCHED_GAP        (4)     /**< maximum unrequested registers read to join two jobs, see #usbiss_sched_gap */
+#define USBISS_SCHED_SLEEP_US   (10000) /**< maximum sleep between cycles in #usbiss_sched_run */
+/** @} */   // USBISS_SCHED
+
+
+
+/**
+ *  @typedef t_usbiss_sched_res
+ *
+ *  @brief  job result
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_sched_res {
+    size_t          job;            /**<  job index, see #usbiss_sched_add */
+    uint64_t        uint64Release;  /**<  planned sample time in us, monotonic */
+    uint64_t        uint64Us;       /**<  completion time of cycle transfers in us, monotonic */
+    int             intRet;         /**<  transfer result, see #usbiss_i2c_xfer */
+    uint8_t         uint8Miss;      /**<  1: completed after deadline */
+    const uint8_t*  data;           /**<  read data, only valid during callback */
+    uint16_t        uint16Len;      /**<  number of bytes in data */
+} t_usbiss_sched_res;
+
+
+
+/**
+ *  @typedef t_usbiss_sched_cb
+ *
+ *  @brief  result consumer
+ *
+ *  called once per job release, the scheduler is not reentrant
+ *
+ *  @param[in,out]  arg                 user argument of job
+ *  @param[in]      res                 result
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+typedef void (*t_usbiss_sched_cb)( void* arg, const t_usbiss_sched_res* res );
+
+
+
+/**
+ *  @typedef t_usbiss_sched_job
+ *
+ *  @brief  periodic register read
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_sched_job {
+    uint8_t             uint8Used;          /**<  1: job active */
+    uint8_t             uint8Adr7;          /**<  Seven Bit I2C address */
+    uint8_t             uint8AdrBytes;      /**<  number of register address bytes, sent big endian */
+    uint32_t            uint32Reg;          /**<  first register */
+    uint16_t            uint16Len;          /**<  number of read bytes */
+    uint32_t            uint32PeriodUs;     /**<  read period */
+    uint32_t            uint32DeadlineUs;   /**<  read finished after release, 0: period */
+    int8_t              int8Gap;            /**<  unrequested registers read to join other jobs, 0: only adjacent jobs, -1: only identical reads */
+    t_usbiss_sched_cb   cb;                 /**<  result consumer */
+    void*               arg;                /**<  argument of cb */
+    uint64_t            uint64Release;      /**<  next release in us */
+    uint32_t            uint32Runs;         /**<  performed reads, statistic */
+    uint32_t            uint32Miss;         /**<  late or skipped reads, statistic */
+    uint32_t            uint32Ero;          /**<  failed reads, statistic */
+    uint8_t             uint8Pack;          /**<  internal: assigned to transfer of current cycle */
+    size_t              xfer;               /**<  internal: transfer of current cycle */
+    uint16_t            uint16Ofs;          /**<  internal: data offset in transfer */
+} t_usbiss_sched_job;
+
+
+
+/**
+ *  @typedef t_usbiss_sched
+ *
+ *  @brief  scheduler
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_sched {
+    t_usbiss*           usbiss;         /**<  opened USB-ISS */
+    t_usbiss_sched_job* job;            /**<  jobs, index is job handle */
+    size_t*             due;            /**<  internal: due jobs of cycle in deadline order */
+    t_usbiss_i2c_xfer*  xfer;           /**<  internal: transfers of cycle */
+    uint8_t*            uint8PtrBuf;    /**<  internal: register addresses and read data of transfers */
+    size_t              num;            /**<  number of allocated jobs */
+    size_t              numXfer;        /**<  internal: allocated transfers, grown at cycle start */
+    uint64_t            uint64Epoch;    /**<  time base of releases in us */
+    uint32_t            uint32Cycles;   /**<  cycles with due jobs, statistic */
+    uint32_t            uint32Xfer;     /**<  I2C transfers, statistic */
+    uint32_t            uint32Runs;     /**<  job reads, statistic */
+    uint32_t            uint32Miss;     /**<  late or skipped job reads, statistic */
+} t_usbiss_sched;
+
+
+
+/**
+ *  @brief C++ Guard
+ *
+ *  Make usable with C++ compiler
+ *
+ *  @see https://stackoverflow.com/questions/14997165/how-to-call-c-function-from-c
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+
+
+/**
+ *  @brief init
+ *
+ *  initializes scheduler without jobs
+ *
+ *  @param[in,out]  self                scheduler handle
+ *  @param[in]      usbiss              opened USB-ISS
+ *  @return         int
+ *  @retval         0                   OK
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_sched_init( t_usbiss_sched *self, t_usbiss *usbiss );
+
+
+
+/**
+ *  @brief add job
+ *
+ *  registers periodic register read. Releases are multiples of the period
+ *  since #usbiss_sched_init, so jobs with harmonic periods are due in the
+ *  same cycle. Jobs of the same slave and address width which are due in
+ *  one cycle and read the same register and length share one transfer,
+ *  other jobs are only joined if enabled by #usbiss_sched_gap. Can be
+ *  called from a job callback, the job is due from the next cycle on.
+ *
+ *  @param[in,out]  self                scheduler handle
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      adrBytes            number of register address bytes, 1 to 4
+ *  @param[in]      reg                 first register
+ *  @param[in]      len                 number of read bytes, max #USBISS_SCHED_BURST
+ *  @param[in]      periodUs            read period
+ *  @param[in]      deadlineUs          read finished after release, 0: period
+ *  @param[in]      cb                  result consumer
+ *  @param[in,out]  arg                 argument of cb
+ *  @return         int
+ *  @retval         >=0                 job index
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_sched_add( t_usbiss_sched *self, uint8_t adr7, uint8_t adrBytes, uint32_t reg, uint16_t len, uint32_t periodUs, uint32_t deadlineUs, t_usbiss_sched_cb cb, void* arg );
+
+
+
+/**
+ *  @brief gap
+ *
+ *  allows joining the job with overlapping, adjacent or up to gap registers
+ *  apart jobs into one read of up to #USBISS_SCHED_BURST bytes. Assumes
+ *  byte addressed registers with auto-increment, one register address per
+ *  data byte, do not enable for 16bit or pointer registers like LM75,
+ *  TMP102 or INA219. The registers in between are read but not delivered,
+ *  so a gap is only for registers without read side effects, f.e. no FIFO
+ *  or clear on read status. Both jobs need to allow joining, the smaller
+ *  gap applies.
+ *
+ *  @param[in,out]  self                scheduler handle
+ *  @param[in]      job                 job index
+ *  @param[in]      gap                 unrequested registers, max #USBISS_SCHED_GAP, 0: only adjacent jobs
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_sched_gap( t_usbiss_sched *self, size_t job, uint8_t gap );
+
+
+
+/**
+ *  @brief remove job
+ *
+ *  job index is reused by next #usbiss_sched_add
+ *
+ *  @param[in,out]  self                scheduler handle
+ *  @param[in]      job                 job index
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+void usbiss_sched_remove( t_usbiss_sched *self, size_t job );
+
+
+
+/**
+ *  @brief cycle
+ *
+ *  reads all due jobs in deadline order. The transfers of a cycle are
+ *  performed by #usbiss_i2c_xfer_pack, so short reads of different slaves
+ *  share direct frames, results are delivered after all transfers. A job
+ *  which is behind by more than one period skips the passed releases, they
+ *  count as missed.
+ *
+ *  @param[in,out]  self                scheduler handle
+ *  @param[out]     sleepUs             time until next release, can be NULL
+ *  @return         int
+ *  @retval         >=0                 number of I2C transfers
+ *  @retval         -1                  FAIL, at least one transfer failed
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_sched_cycle( t_usbiss_sched *self, uint32_t *sleepUs );
+
+
+
+/**
+ *  @brief run
+ *
+ *  performs cycles and sleeps until next release, at most
+ *  #USBISS_SCHED_SLEEP_US to check stop
+ *
+ *  @param[in,out]  self                scheduler handle
+ *  @param[in]      durationUs          run time, 0: until stop
+ *  @param[in]      stop                stops scheduler if unequal zero, can be NULL
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, no jobs
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_sched_run( t_usbiss_sched *self, uint64_t durationUs, volatile int *stop );
+
+
+
+/**
+ *  @brief free
+ *
+ *  releases all jobs
+ *
+ *  @param[in,out]  self                scheduler handle
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+void usbiss_sched_free( t_usbiss_sched *self );
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+
+#endif // __USB_ISS_SCHED_H
@@ -0,0 +1,612 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_shm.c
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS shared memory access
+                  multiple processes share one USB-ISS without daemon:
+                    * first process owns the adapter
+                    * other processes submit transfers through a
+                      shared memory ring
+                    * ownership handover if the owner dies
+***********************************************************************/
+
+
+
+/** Includes **/
+/* Standard libs */
+#include <stdio.h>      // f.e. printf
+#include <stdlib.h>     // malloc
+#include <stdint.h>     // defines fixed data types, like int8_t...
+#include <string.h>     // string handling functions
+#include <errno.h>      // EBUSY, EOWNERDEAD
+#if defined(__linux__)
+    #include <fcntl.h>          // O_CREAT
+    #include <signal.h>         // kill
+    #include <time.h>           // nanosleep
+    #include <unistd.h>         // ftruncate, getpid
+    #include <sys/mman.h>       // shm_open, mmap
+    #include <sys/stat.h>       // fstat
+    #include <sys/syscall.h>    // SYS_futex
+    #include <linux/futex.h>    // FUTEX_WAIT
+#endif
+/** self **/
+#include "usbiss.h"     // USBISS driver
+#include "usbiss_shm.h" // some defs
+
+
+
+#if defined(__linux__)
+
+/**
+ *  @brief futex wait
+ *
+ *  sleeps while *addr equals val, at most #USBISS_SHM_TMO_US
+ *
+ *  @param[in]      addr                futex word in shared memory
+ *  @param[in]      val                 expected value
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_shm_wait( uint32_t* addr, uint32_t val )
+{
+    /** Variables **/
+    struct timespec tmo = { 0, USBISS_SHM_TMO_US * 1000L };
+
+    syscall(SYS_futex, addr, FUTEX_WAIT, val, &tmo, NULL, 0);
+}
+
+
+
+/**
+ *  @brief futex wake
+ *
+ *  wakes all waiters on addr
+ *
+ *  @param[in]      addr                futex word in shared memory
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_shm_wake( uint32_t* addr )
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE, __INT32_MAX__, NULL, NULL, 0);
+}
+
+
+
+/**
+ *  @brief free slot
+ *
+ *  releases slot and wakes processes waiting for a free slot
+ *
+ *  @param[in,out]  ring                shared memory segment
+ *  @param[in,out]  slot                slot of ring
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void usbiss_shm_free( t_usbiss_shm_ring* ring, t_usbiss_shm_slot* slot )
+{
+    __atomic_store_n(&slot->int32Pid, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->uint32State, USBISS_SHM_FREE, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&ring->uint32Free, 1, __ATOMIC_RELEASE);
+    usbiss_shm_wake(&ring->uint32Free);
+}
+
+
+
+/**
+ *  @brief recover slots
+ *
+ *  frees slots of died submitters. Only claimed and done slots are
+ *  recovered, the owner does not touch them. Requested slots are executed
+ *  by the owner and recovered when done.
+ *
+ *  @param[in,out]  ring                shared memory segment
+ *  @return         uint8_t             number of recovered slots
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static uint8_t usbiss_shm_recover( t_usbiss_shm_ring* ring )
+{
+    /** Variables **/
+    t_usbiss_shm_slot*  slot;           // checked slot
+    uint32_t            uint32State;    // slot state
+    int32_t             int32Pid;       // submitter of slot
+    uint8_t             uint8Num = 0;   // recovered slots
+
+    for ( uint8_t i = 0; i < USBISS_SHM_SLOTS; i++ ) {
+        slot = &ring->slot[i];
+        uint32State = __atomic_load_n(&slot->uint32State, __ATOMIC_ACQUIRE);
+        if ( (USBISS_SHM_CLAIM != uint32State) && (USBISS_SHM_DONE != uint32State) ) {
+            continue;
+        }
+        int32Pid = __atomic_load_n(&slot->int32Pid, __ATOMIC_ACQUIRE);
+        if ( (0 == int32Pid) || (0 == kill((pid_t) int32Pid, 0)) || (ESRCH != errno) ) {
+            continue;   // not yet assigned or submitter alive
+        }
+        /* one recovering process wins the lease */
+        if ( __atomic_compare_exchange_n(&slot->int32Pid, &int32Pid, 0, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) ) {
+            usbiss_shm_free(ring, slot);
+            ++uint8Num;
+        }
+    }
+    return uint8Num;
+}
+
+
+
+/**
+ *  @brief execute
+ *
+ *  performs operation on owned adapter, serializes service thread and
+ *  direct transfers of the owning process
+ *
+ *  @param[in,out]  self                shared memory handle
+ *  @param[in]      op                  operation, #USBISS_SHM_OP
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      wr                  write data
+ *  @param[in]      wrLen               number of bytes to write
+ *  @param[out]     rd                  read data, separate from wr
+ *  @param[in]      rdLen               number of bytes to read
+ *  @return         int                 operation result
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_shm_exec( t_usbiss_shm *self, uint8_t op, uint8_t adr7, const void* wr, size_t wrLen, void* rd, size_t rdLen )
+{
+    /** Variables **/
+    t_usbiss_i2c_xfer   xfer;           // I2C transfer
+    char                charMode[32];   // transfer mode
+    int                 intRet;         // operation result
+
+    pthread_mutex_lock(&self->mtxDrv);
+    if ( USBISS_SHM_MODE == op ) {
+        snprintf(charMode, sizeof(charMode), "%.*s", (int) wrLen, (const char*) wr);
+        intRet = usbiss_set_mode(self->usbiss, charMode);
+        if ( 0 == intRet ) {
+            __atomic_store_n(&self->ring->uint32Mode, USBISS_SHM_MODE_SET | self->usbiss->uint8Mode, __ATOMIC_RELEASE);
+        }
+    } else {
+        xfer.uint8Adr7 = adr7;
+        xfer.wr = (void*) wr;
+        xfer.wrLen = wrLen;
+        xfer.rd = rd;
+        xfer.rdLen = rdLen;
+        intRet = usbiss_i2c_xfer(self->usbiss, &xfer);
+    }
+    pthread_mutex_unlock(&self->mtxDrv);
+    return intRet;
+}
+
+
+
+/**
+ *  @brief service thread
+ *
+ *  executes requested transfers of all processes on the owned adapter
+ *
+ *  @param[in,out]  arg                 shared memory handle #t_usbiss_shm
+ *  @return         void*               NULL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static void* usbiss_shm_serve( void* arg )
+{
+    /** Variables **/
+    t_usbiss_shm*       self = arg;     // shared memory handle
+    t_usbiss_shm_ring*  ring = self->ring;
+    t_usbiss_shm_slot*  slot;           // processed slot
+    uint32_t            uint32Bell;     // doorbell before scan
+    uint32_t            uint32State;    // expected slot state
+    uint8_t             uint8Work;      // request processed in scan
+
+    while ( 0 == self->intStop ) {
+        uint32Bell = __atomic_load_n(&ring->uint32Doorbell, __ATOMIC_ACQUIRE);
+        uint8Work = 0;
+        for ( uint8_t i = 0; i < USBISS_SHM_SLOTS; i++ ) {
+            slot = &ring->slot[i];
+            uint32State = USBISS_SHM_REQ;
+            if ( !__atomic_compare_exchange_n(&slot->uint32State, &uint32State, USBISS_SHM_BUSY, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) {
+                continue;
+            }
+            uint8Work = 1;
+            slot->int32Ret = usbiss_shm_exec(self, slot->uint8Op, slot->uint8Adr7, slot->uint8Wr, slot->uint16WrLen, slot->uint8Rd, slot->uint16RdLen);
+            __atomic_store_n(&slot->uint32State, USBISS_SHM_DONE, __ATOMIC_RELEASE);
+            usbiss_shm_wake(&slot->uint32State);
+        }
+        /* sleep until next request */
+        if ( 0 == uint8Work ) {
+            usbiss_shm_wait(&ring->uint32Doorbell, uint32Bell);
+        }
+    }
+    return NULL;
+}
+
+
+
+/**
+ *  @brief take ownership
+ *
+ *  opens adapter and starts service thread, owner lock is already acquired
+ *
+ *  @param[in,out]  self                shared memory handle
+ *  @param[in]      uint8Dead           1: previous owner died
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL, owner lock released
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_shm_own( t_usbiss_shm *self, uint8_t uint8Dead )
+{
+    /** Variables **/
+    t_usbiss_shm_ring*  ring = self->ring;
+    t_usbiss_shm_slot*  slot;           // transfer slot
+    uint32_t            uint32State;    // expected slot state
+    uint32_t            uint32Mode;     // requested transfer mode
+
+    /* previous owner died, lock is usable again */
+    if ( 0 != uint8Dead ) {
+        pthread_mutex_consistent(&ring->mtxOwner);
+        ++(ring->uint32Handover);
+        /* interrupted transfers, state on bus unknown */
+        for ( uint8_t i = 0; i < USBISS_SHM_SLOTS; i++ ) {
+            slot = &ring->slot[i];
+            uint32State = USBISS_SHM_BUSY;
+            if ( __atomic_compare_exchange_n(&slot->uint32State, &uint32State, USBISS_SHM_DONE, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) ) {
+                slot->int32Ret = USBISS_SHM_OWNER_LOST;
+                usbiss_shm_wake(&slot->uint32State);
+            }
+        }
+    }
+    /* open adapter */
+    if ( 0 != usbiss_open_serial(self->usbiss, self->charSerial, self->uint32Baud) ) {
+        pthread_mutex_unlock(&ring->mtxOwner);
+        return -1;
+    }
+    uint32Mode = __atomic_load_n(&ring->uint32Mode, __ATOMIC_ACQUIRE);
+    if ( 0 != (uint32Mode & USBISS_SHM_MODE_SET) ) {
+        usbiss_set_mode(self->usbiss, usbiss_mode_to_human((uint8_t) (uint32Mode & 0xff)));
+    }
+    /* serve */
+    self->intStop = 0;
+    if ( 0 != pthread_create(&self->thrd, NULL, usbiss_shm_serve, self) ) {
+        usbiss_close(self->usbiss);
+        pthread_mutex_unlock(&ring->mtxOwner);
+        return -1;
+    }
+    ring->int32OwnerPid = (int32_t) getpid();
+    self->uint8Owner = 1;
+    return 0;
+}
+
+
+
+/**
+ *  @brief owner check
+ *
+ *  takes adapter over if owner died or released it
+ *
+ *  @param[in,out]  self                shared memory handle
+ *  @return         int
+ *  @retval         0                   OK, owner alive or taken over
+ *  @retval         -1                  FAIL, takeover failed
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_shm_owner( t_usbiss_shm *self )
+{
+    /** Variables **/
+    int intRet;
+
+    if ( 0 != self->uint8Owner ) {
+        return 0;
+    }
+    intRet = pthread_mutex_trylock(&self->ring->mtxOwner);
+    if ( EBUSY == intRet ) {
+        return 0;
+    }
+    if ( (0 != intRet) && (EOWNERDEAD != intRet) ) {
+        return -1;
+    }
+    return usbiss_shm_own(self, (uint8_t) (EOWNERDEAD == intRet));
+}
+
+
+
+/**
+ *  @brief submit
+ *
+ *  submits operation to ring and waits for result, the owner performs
+ *  the operation directly
+ *
+ *  @param[in,out]  self                shared memory handle
+ *  @param[in]      op                  operation, #USBISS_SHM_OP
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      wr                  write data
+ *  @param[in]      wrLen               number of bytes to write
+ *  @param[out]     rd                  read data
+ *  @param[in]      rdLen               number of bytes to read
+ *  @return         int                 operation result
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+static int usbiss_shm_submit( t_usbiss_shm *self, uint8_t op, uint8_t adr7, const void* wr, size_t wrLen, void* rd, size_t rdLen )
+{
+    /** Variables **/
+    t_usbiss_shm_ring*  ring = self->ring;
+    t_usbiss_shm_slot*  slot = NULL;    // claimed slot
+    uint32_t            uint32State;    // slot state
+    uint32_t            uint32Free;     // free sequence before scan
+    uint8_t             uint8Wr[USBISS_SHM_DATA];   // write data of owner, if read overwrites it
+    int                 intRet;         // operation result
+
+    /* check */
+    if ( (NULL == ring) || (wrLen > USBISS_SHM_DATA) || (rdLen > USBISS_SHM_DATA) ) {
+        return -1;
+    }
+    /* owner calls driver directly */
+    if ( 0 != self->uint8Owner ) {
+        if ( (0 != rdLen) && (0 != wrLen) && (rd == wr) ) {
+            memcpy(uint8Wr, wr, wrLen);
+            wr = uint8Wr;
+        }
+        return usbiss_shm_exec(self, op, adr7, wr, wrLen, rd, rdLen);
+    }
+    /* claim free slot */
+    while ( NULL == slot ) {
+        uint32Free = __atomic_load_n(&ring->uint32Free, __ATOMIC_ACQUIRE);
+        for ( uint8_t i = 0; i < USBISS_SHM_SLOTS; i++ ) {
+            uint32State = USBISS_SHM_FREE;
+            if ( __atomic_compare_exchange_n(&ring->slot[i].uint32State, &uint32State, USBISS_SHM_CLAIM, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ) {
+                slot = &ring->slot[i];
+                break;
+            }
+        }
+        if ( (NULL == slot) && (0 == usbiss_shm_recover(ring)) ) {
+            usbiss_shm_wait(&ring->uint32Free, uint32Free);
+        }
+    }
+    __atomic_store_n(&slot->int32Pid, (int32_t) getpid(), __ATOMIC_RELEASE);
+    /* fill and request */
+    slot->uint8Op = op;
+    slot->uint8Adr7 = adr7;
+    slot->uint16WrLen = (uint16_t) wrLen;
+    slot->uint16RdLen = (uint16_t) rdLen;
+    if ( 0 != wrLen ) {
+        memcpy(slot->uint8Wr, wr, wrLen);
+    }
+    __atomic_store_n(&slot->uint32State, USBISS_SHM_REQ, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&ring->uint32Doorbell, 1, __ATOMIC_RELEASE);
+    usbiss_shm_wake(&ring->uint32Doorbell);
+    /* wait for result, take over if owner is gone */
+    while ( USBISS_SHM_DONE != (uint32State = __atomic_load_n(&slot->uint32State, __ATOMIC_ACQUIRE)) ) {
+        usbiss_shm_wait(&slot->uint32State, uint32State);
+        if ( USBISS_SHM_DONE != __atomic_load_n(&slot->uint32State, __ATOMIC_ACQUIRE) ) {
+            if ( 0 != usbiss_shm_owner(self) ) {
+                /* withdraw request if no owner picked it up */
+                uint32State = USBISS_SHM_REQ;
+                if ( __atomic_compare_exchange_n(&slot->uint32State, &uint32State, USBISS_SHM_CLAIM, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) ) {
+                    usbiss_shm_free(ring, slot);
+                    return -1;
+                }
+            }
+        }
+    }
+    /* result */
+    intRet = slot->int32Ret;
+    if ( (0 == intRet) && (0 != rdLen) ) {
+        memcpy(rd, slot->uint8Rd, rdLen);
+    }
+    usbiss_shm_free(ring, slot);
+    return intRet;
+}
+
+#endif  // __linux__
+
+
+
+/**
+ *  usbiss_shm_open
+ *    attach to adapter ring
+ */
+int usbiss_shm_open( t_usbiss_shm *self, t_usbiss *usbiss, const char* serial, uint32_t baud )
+{
+#if defined(__linux__)
+    /** Variables **/
+    pthread_mutexattr_t attr;           // robust, process shared
+    struct stat         st;             // segment size
+    struct timespec     tmo = { 0, 1000000L };  // wait for creator
+    char                charName[64];   // segment name
+    int                 fd;             // segment
+    uint8_t             uint8Create;    // segment created by this process
+    int                 intRet;         // help variable
+
+    /* Function Call Message */
+    if ( 0 != usbiss->uint8MsgLevel ) { printf("__FUNCTION__ = %s\n", __FUNCTION__); };
+    /* init */
+    memset(self, 0, sizeof(*self));
+    pthread_mutex_init(&self->mtxDrv, NULL);
+    self->usbiss = usbiss;
+    self->uint32Baud = baud;
+    if ( !(strlen(serial) < sizeof(self->charSerial)) ) {
+        return -1;
+    }
+    strncpy(self->charSerial, serial, sizeof(self->charSerial) - 1);
+    snprintf(charName, sizeof(charName), "/usbiss-%s", serial);
+    /* attach to segment, segment of died creator is removed once */
+    for ( uint8_t uint8Try = 0; NULL == self->ring; uint8Try++ ) {
+        uint8Create = 1;
+        fd = shm_open(charName, O_RDWR | O_CREAT | O_EXCL, 0660);
+        if ( (0 > fd) && (EEXIST == errno) ) {
+            uint8Create = 0;
+            fd = shm_open(charName, O_RDWR, 0660);
+        }
+        if ( 0 > fd ) {
+            if ( 0 != usbiss->uint8MsgLevel ) {
+                printf("  ERROR:%s: shared memory '%s'\n", __FUNCTION__, charName);
+            }
+            return -1;
+        }
+        if ( 0 != uint8Create ) {
+            if ( 0 != ftruncate(fd, sizeof(t_usbiss_shm_ring)) ) {
+                close(fd);
+                shm_unlink(charName);
+                return -1;
+            }
+        } else {
+            for ( uint16_t i = 0; i < 1000; i++ ) {     // creator sizes segment
+                if ( (0 == fstat(fd, &st)) && (sizeof(t_usbiss_shm_ring) == (size_t) st.st_size) ) {
+                    break;
+                }
+                nanosleep(&tmo, NULL);
+            }
+            if ( (0 != fstat(fd, &st)) || (sizeof(t_usbiss_shm_ring) != (size_t) st.st_size) ) {
+                close(fd);
+                if ( 0 != uint8Try ) {
+                    return -1;
+                }
+                if ( 0 != usbiss->uint8MsgLevel ) {
+                    printf("  INFO:%s: remove stale shared memory '%s'\n", __FUNCTION__, charName);
+                }
+                shm_unlink(charName);
+                continue;
+            }
+        }
+        self->ring = mmap(NULL, sizeof(t_usbiss_shm_ring), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if ( MAP_FAILED == self->ring ) {
+            self->ring = NULL;
+            return -1;
+        }
+        /* initialize ring, robust lock survives owner death */
+        if ( 0 != uint8Create ) {
+            pthread_mutexattr_init(&attr);
+            pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+            pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+            pthread_mutex_init(&self->ring->mtxOwner, &attr);
+            pthread_mutexattr_destroy(&attr);
+            __atomic_store_n(&self->ring->uint32Magic, USBISS_SHM_MAGIC, __ATOMIC_RELEASE);
+        } else {
+            for ( uint16_t i = 0; (i < 1000) && (USBISS_SHM_MAGIC != __atomic_load_n(&self->ring->uint32Magic, __ATOMIC_ACQUIRE)); i++ ) {
+                nanosleep(&tmo, NULL);
+            }
+            if ( USBISS_SHM_MAGIC != __atomic_load_n(&self->ring->uint32Magic, __ATOMIC_ACQUIRE) ) {
+                munmap(self->ring, sizeof(t_usbiss_shm_ring));
+                self->ring = NULL;
+                if ( 0 != uint8Try ) {
+                    return -1;
+                }
+                if ( 0 != usbiss->uint8MsgLevel ) {
+                    printf("  INFO:%s: remove stale shared memory '%s'\n", __FUNCTION__, charName);
+                }
+                shm_unlink(charName);
+            }
+        }
+    }
+    /* first process owns adapter */
+    intRet = usbiss_shm_owner(self);
+    if ( 0 != intRet ) {
+        if ( 0 != usbiss->uint8MsgLevel ) {
+            printf("  ERROR:%s: open adapter '%s'\n", __FUNCTION__, serial);
+        }
+        munmap(self->ring, sizeof(t_usbiss_shm_ring));
+        self->ring = NULL;
+        return -1;
+    }
+    if ( 0 != usbiss->uint8MsgLevel ) {
+        printf("  INFO:%s: %s adapter %s\n", __FUNCTION__, (0 != self->uint8Owner) ? "owns" : "shares", serial);
+    }
+    return 0;
+#else
+    (void) self;
+    (void) serial;
+    (void) baud;
+    if ( 0 != usbiss->uint8MsgLevel ) {
+        printf("  ERROR:%s: not supported on this platform\n", __FUNCTION__);
+    }
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_shm_close
+ *    detach from adapter ring
+ */
+int usbiss_shm_close( t_usbiss_shm *self )
+{
+#if defined(__linux__)
+    /** Variables **/
+    int intRet = 0;
+
+    if ( NULL == self->ring ) {
+        return 0;
+    }
+    /* hand adapter over */
+    if ( 0 != self->uint8Owner ) {
+        self->intStop = 1;
+        usbiss_shm_wake(&self->ring->uint32Doorbell);
+        pthread_join(self->thrd, NULL);
+        intRet = usbiss_close(self->usbiss);
+        self->ring->int32OwnerPid = 0;
+        self->uint8Owner = 0;
+        pthread_mutex_unlock(&self->ring->mtxOwner);
+    }
+    munmap(self->ring, sizeof(t_usbiss_shm_ring));
+    self->ring = NULL;
+    pthread_mutex_destroy(&self->mtxDrv);
+    return intRet;
+#else
+    (void) self;
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_shm_set_mode
+ *    set transfer mode
+ */
+int usbiss_shm_set_mode( t_usbiss_shm *self, const char* mode )
+{
+#if defined(__linux__)
+    return usbiss_shm_submit(self, USBISS_SHM_MODE, 0, mode, strnlen(mode, 31), NULL, 0);
+#else
+    (void) self;
+    (void) mode;
+    return -1;
+#endif
+}
+
+
+
+/**
+ *  usbiss_shm_i2c
+ *    I2C transfer
+ */
+int usbiss_shm_i2c( t_usbiss_shm *self, uint8_t adr7, const void* wr, size_t wrLen, void* rd, size_t rdLen )
+{
+#if defined(__linux__)
+    return usbiss_shm_submit(self, USBISS_SHM_XFER, adr7, wr, wrLen, rd, rdLen);
+#else
+    (void) self;
+    (void) adr7;
+    (void) wr;
+    (void) wrLen;
+    (void) rd;
+    (void) rdLen;
+    return -1;
+#endif
+}
@@ -0,0 +1,245 @@
+/***********************************************************************
+ @copyright     : Siemens AG
+ @license       : GPLv3
+ @author        : Andreas Kaeberlein
+ @address       : Clemens-Winkler-Strasse 3, 09116 Chemnitz
+
+ @maintainer    : Andreas Kaeberlein
+ @telephone     : +49 371 4810-2108
+ @email         : andreas.kaeberlein@siemens.com
+
+ @file          : usbiss_shm.h
+ @date          : 2026-10-18
+ @see           : https://github.com/andkae/usbiss
+
+ @brief         : USB-ISS shared memory access
+                  multiple processes share one USB-ISS without daemon:
+                    * first process owns the adapter
+                    * other processes submit transfers through a
+                      shared memory ring
+                    * ownership handover if the owner dies
+***********************************************************************/
+
+
+
+// Define Guard
+#ifndef __USB_ISS_SHM_H
+#define __USB_ISS_SHM_H
+
+
+/** Includes **/
+#include <pthread.h>    // robust mutex, service thread
+#include "usbiss.h"     // USBISS driver
+
+
+
+/**
+ *  @defgroup USBISS_SHM
+ *  Shared memory ring
+ *
+ *  @{
+ */
+#define USBISS_SHM_MAGIC        (0x55534953)    /**< ring initialized */
+#define USBISS_SHM_SLOTS        (16)            /**< number of transfer slots */
+#define USBISS_SHM_DATA         (512)           /**< maximum write/read data per transfer */
+#define USBISS_SHM_TMO_US       (100000)        /**< waiter checks owner after this time */
+#define USBISS_SHM_OWNER_LOST   (-3)            /**< owner died during transfer, transfer state unknown, retry */
+#define USBISS_SHM_MODE_SET     (0x100)         /**< uint32Mode holds requested transfer mode */
+/** @} */   // USBISS_SHM
+
+
+
+/**
+ *  @defgroup USBISS_SHM_STATE
+ *  Transfer slot states
+ *
+ *  @{
+ */
+#define USBISS_SHM_FREE     (0)     /**< slot unused */
+#define USBISS_SHM_CLAIM    (1)     /**< slot filled by submitter */
+#define USBISS_SHM_REQ      (2)     /**< transfer requested */
+#define USBISS_SHM_BUSY     (3)     /**< transfer executed by owner */
+#define USBISS_SHM_DONE     (4)     /**< result available */
+/** @} */   // USBISS_SHM_STATE
+
+
+
+/**
+ *  @defgroup USBISS_SHM_OP
+ *  Transfer slot operations
+ *
+ *  @{
+ */
+#define USBISS_SHM_XFER     (0)     /**< I2C transfer */
+#define USBISS_SHM_MODE     (1)     /**< set transfer mode, write data is mode name */
+/** @} */   // USBISS_SHM_OP
+
+
+
+/**
+ *  @typedef t_usbiss_shm_slot
+ *
+ *  @brief  transfer slot
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_shm_slot {
+    uint32_t    uint32State;                /**<  slot state, #USBISS_SHM_STATE, futex */
+    int32_t     int32Pid;                   /**<  process id of submitter, 0: free; slots of died submitters are recovered */
+    int32_t     int32Ret;                   /**<  transfer result */
+    uint8_t     uint8Op;                    /**<  operation, #USBISS_SHM_OP */
+    uint8_t     uint8Adr7;                  /**<  Seven Bit I2C address */
+    uint16_t    uint16WrLen;                /**<  number of write bytes */
+    uint16_t    uint16RdLen;                /**<  number of read bytes */
+    uint8_t     uint8Wr[USBISS_SHM_DATA];   /**<  write data */
+    uint8_t     uint8Rd[USBISS_SHM_DATA];   /**<  read data */
+} t_usbiss_shm_slot;
+
+
+
+/**
+ *  @typedef t_usbiss_shm_ring
+ *
+ *  @brief  shared memory segment
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_shm_ring {
+    uint32_t            uint32Magic;        /**<  #USBISS_SHM_MAGIC if initialized */
+    uint32_t            uint32Doorbell;     /**<  incremented on new request, futex */
+    uint32_t            uint32Free;         /**<  incremented on freed slot, futex */
+    pthread_mutex_t     mtxOwner;           /**<  robust, held by owner process */
+    int32_t             int32OwnerPid;      /**<  process id of owner */
+    uint32_t            uint32Handover;     /**<  number of ownership takeovers */
+    uint32_t            uint32Mode;         /**<  #USBISS_SHM_MODE_SET | last requested transfer mode, restored by new owner */
+    t_usbiss_shm_slot   slot[USBISS_SHM_SLOTS]; /**<  transfer slots */
+} t_usbiss_shm_ring;
+
+
+
+/**
+ *  @typedef t_usbiss_shm
+ *
+ *  @brief  process local handle
+ *
+ *  @since  October 18, 2026
+ *  @author Andreas Kaeberlein
+ */
+typedef struct t_usbiss_shm {
+    t_usbiss_shm_ring*  ring;           /**<  mapped shared memory */
+    t_usbiss*           usbiss;         /**<  USB-ISS handle, opened if owner */
+    char                charSerial[32]; /**<  USB serial number of adapter */
+    uint32_t            uint32Baud;     /**<  UART baudrate */
+    uint8_t             uint8Owner;     /**<  1: process owns adapter */
+    pthread_t           thrd;           /**<  service thread of owner */
+    pthread_mutex_t     mtxDrv;         /**<  serializes service thread and direct transfers of owner */
+    volatile int        intStop;        /**<  stops service thread */
+} t_usbiss_shm;
+
+
+
+/**
+ *  @brief C++ Guard
+ *
+ *  Make usable with C++ compiler
+ *
+ *  @see https://stackoverflow.com/questions/14997165/how-to-call-c-function-from-c
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+
+
+/**
+ *  @brief open
+ *
+ *  attaches to shared memory ring of the adapter with given serial number.
+ *  The first process opens the adapter, performs its own transfers directly
+ *  and serves the transfers of following processes in a service thread.
+ *  If the owner dies a waiting process takes the adapter over. Slots of died submitters are recovered
+ *  if all slots are in use. A segment whose creator died before
+ *  initialization is removed and created again. The robust owner lock
+ *  belongs to the calling thread, open and close from the same thread.
+ *
+ *  @param[in,out]  self                shared memory handle
+ *  @param[in,out]  usbiss              initialized, not opened USB-ISS handle, used as owner
+ *  @param[in]      serial              USB serial number of adapter
+ *  @param[in]      baud                UART baudrate, 0 for default
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_shm_open( t_usbiss_shm *self, t_usbiss *usbiss, const char* serial, uint32_t baud );
+
+
+
+/**
+ *  @brief close
+ *
+ *  detaches from ring, owner finishes the running transfer and hands the
+ *  adapter over to the next waiting process
+ *
+ *  @param[in,out]  self                shared memory handle
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_shm_close( t_usbiss_shm *self );
+
+
+
+/**
+ *  @brief mode
+ *
+ *  sets transfer mode through ring, the owner calls the driver directly,
+ *  see #usbiss_set_mode
+ *
+ *  @param[in,out]  self                shared memory handle
+ *  @param[in]      mode                transfer mode, f.e. I2C_S_100KHZ
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_shm_set_mode( t_usbiss_shm *self, const char* mode );
+
+
+
+/**
+ *  @brief I2C transfer
+ *
+ *  I2C write, read or write-read with repeated start through ring,
+ *  the owner calls the driver directly
+ *
+ *  @param[in,out]  self                shared memory handle
+ *  @param[in]      adr7                Seven Bit I2C address
+ *  @param[in]      wr                  write data
+ *  @param[in]      wrLen               number of bytes to write, max #USBISS_SHM_DATA
+ *  @param[out]     rd                  read data, allowed to be equal wr
+ *  @param[in]      rdLen               number of bytes to read, max #USBISS_SHM_DATA
+ *  @return         int
+ *  @retval         0                   OK
+ *  @retval         -1                  FAIL
+ *  @retval         >0                  USB-ISS error code, #USBISS_ERROR
+ *  @retval         #USBISS_SHM_OWNER_LOST  owner died, retry
+ *  @since          October 18, 2026
+ *  @author         Andreas Kaeberlein
+ */
+int usbiss_shm_i2c( t_usbiss_shm *self, uint8_t adr7, const void* wr, size_t wrLen, void* rd, size_t rdLen );
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+
+#endif // __USB_ISS_SHM_H